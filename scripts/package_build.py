@@ -37,6 +37,7 @@ def third_party_includes():
     includes += [os.path.join('third_party', 'utf8proc')]
     includes += [os.path.join('third_party', 'utf8proc', 'include')]
     includes += [os.path.join('third_party', 'yyjson', 'include')]
+    includes += [os.path.join('third_party', 'zstd', 'include')]
     return includes
 
 
@@ -45,6 +46,7 @@ def third_party_sources():
     sources += [os.path.join('third_party', 'fmt')]
     sources += [os.path.join('third_party', 'fsst')]
     sources += [os.path.join('third_party', 'miniz')]
+    sources += [os.path.join('third_party', 'lz4')]
     sources += [os.path.join('third_party', 're2')]
     sources += [os.path.join('third_party', 'hyperloglog')]
     sources += [os.path.join('third_party', 'skiplist')]
@@ -53,6 +55,7 @@ def third_party_sources():
     sources += [os.path.join('third_party', 'libpg_query')]
     sources += [os.path.join('third_party', 'mbedtls')]
     sources += [os.path.join('third_party', 'yyjson')]
+    sources += [os.path.join('third_party', 'zstd')]
     return sources
 
 
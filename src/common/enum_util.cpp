@@ -15,6 +15,7 @@
 #include "duckdb/common/box_renderer.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
 #include "duckdb/common/enums/aggregate_handling.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/catalog_lookup_behavior.hpp"
 #include "duckdb/common/enums/catalog_type.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
@@ -768,6 +769,29 @@ BlockState EnumUtil::FromString<BlockState>(const char *value) {
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value) {
+	switch(value) {
+	case BufferEvictionPolicy::LRU:
+		return "LRU";
+	case BufferEvictionPolicy::TWO_QUEUE:
+		return "TWO_QUEUE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value) {
+	if (StringUtil::Equals(value, "LRU")) {
+		return BufferEvictionPolicy::LRU;
+	}
+	if (StringUtil::Equals(value, "TWO_QUEUE")) {
+		return BufferEvictionPolicy::TWO_QUEUE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value) {
 	switch(value) {
@@ -1248,6 +1272,8 @@ const char* EnumUtil::ToChars<CompressionType>(CompressionType value) {
 		return "COMPRESSION_ALP";
 	case CompressionType::COMPRESSION_ALPRD:
 		return "COMPRESSION_ALPRD";
+	case CompressionType::COMPRESSION_ZSTD:
+		return "COMPRESSION_ZSTD";
 	case CompressionType::COMPRESSION_COUNT:
 		return "COMPRESSION_COUNT";
 	default:
@@ -1293,6 +1319,9 @@ CompressionType EnumUtil::FromString<CompressionType>(const char *value) {
 	if (StringUtil::Equals(value, "COMPRESSION_ALPRD")) {
 		return CompressionType::COMPRESSION_ALPRD;
 	}
+	if (StringUtil::Equals(value, "COMPRESSION_ZSTD")) {
+		return CompressionType::COMPRESSION_ZSTD;
+	}
 	if (StringUtil::Equals(value, "COMPRESSION_COUNT")) {
 		return CompressionType::COMPRESSION_COUNT;
 	}
@@ -4978,6 +5007,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "HASH_GROUP_BY";
 	case PhysicalOperatorType::PERFECT_HASH_GROUP_BY:
 		return "PERFECT_HASH_GROUP_BY";
+	case PhysicalOperatorType::STREAMING_GROUP_BY:
+		return "STREAMING_GROUP_BY";
 	case PhysicalOperatorType::FILTER:
 		return "FILTER";
 	case PhysicalOperatorType::PROJECTION:
@@ -5150,6 +5181,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "PERFECT_HASH_GROUP_BY")) {
 		return PhysicalOperatorType::PERFECT_HASH_GROUP_BY;
 	}
+	if (StringUtil::Equals(value, "STREAMING_GROUP_BY")) {
+		return PhysicalOperatorType::STREAMING_GROUP_BY;
+	}
 	if (StringUtil::Equals(value, "FILTER")) {
 		return PhysicalOperatorType::FILTER;
 	}
@@ -7134,6 +7168,34 @@ TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value)
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
+template<>
+const char* EnumUtil::ToChars<TemporaryCompression>(TemporaryCompression value) {
+	switch(value) {
+	case TemporaryCompression::NONE:
+		return "NONE";
+	case TemporaryCompression::LZ4:
+		return "LZ4";
+	case TemporaryCompression::ADAPTIVE:
+		return "ADAPTIVE";
+	default:
+		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
+	}
+}
+
+template<>
+TemporaryCompression EnumUtil::FromString<TemporaryCompression>(const char *value) {
+	if (StringUtil::Equals(value, "NONE")) {
+		return TemporaryCompression::NONE;
+	}
+	if (StringUtil::Equals(value, "LZ4")) {
+		return TemporaryCompression::LZ4;
+	}
+	if (StringUtil::Equals(value, "ADAPTIVE")) {
+		return TemporaryCompression::ADAPTIVE;
+	}
+	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
+}
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value) {
 	switch(value) {
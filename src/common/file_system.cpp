@@ -362,6 +362,12 @@ void FileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t
 	throw NotImplementedException("%s: Read (with location) is not implemented!", GetName());
 }
 
+void FileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	for (auto &request : requests) {
+		Read(handle, request.buffer, request.nr_bytes, request.location);
+	}
+}
+
 bool FileSystem::Trim(FileHandle &handle, idx_t offset_bytes, idx_t length_bytes) {
 	// This is not a required method. Derived FileSystems may optionally override/implement.
 	return false;
@@ -58,6 +58,22 @@ extern "C" WINBASEAPI BOOL QueryFullProcessImageNameW(HANDLE, DWORD, LPWSTR, PDW
 #include <restartmanager.h>
 #endif
 
+// io_uring is used through the raw system calls, so only the kernel headers are required
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define DUCKDB_HAS_IO_URING
+#endif
+// the kernel headers define macros that clash with identifiers of the other files of the unity build
+#undef BLOCK_SIZE
+#undef MAP_TYPE
+#endif
+#endif
+
 namespace duckdb {
 
 #ifndef _WIN32
@@ -437,6 +453,237 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+#ifdef DUCKDB_HAS_IO_URING
+//! A minimal io_uring instance that submits a batch of reads and waits for all of them to complete
+class IOUring {
+public:
+	static constexpr uint32_t QUEUE_DEPTH = 64;
+
+	~IOUring() {
+		Close();
+	}
+
+	bool Open() {
+		io_uring_params params;
+		memset(&params, 0, sizeof(params));
+		auto fd = syscall(__NR_io_uring_setup, QUEUE_DEPTH, &params);
+		if (fd < 0) {
+			return false;
+		}
+		ring_fd = NumericCast<int>(fd);
+		sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+		cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+		bool single_mmap = false;
+#ifdef IORING_FEAT_SINGLE_MMAP
+		single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+#endif
+		if (single_mmap) {
+			sq_ring_size = MaxValue(sq_ring_size, cq_ring_size);
+			cq_ring_size = sq_ring_size;
+		}
+		sq_ring = Map(sq_ring_size, IORING_OFF_SQ_RING);
+		cq_ring = single_mmap ? sq_ring : Map(cq_ring_size, IORING_OFF_CQ_RING);
+		sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+		auto sqes_ptr = Map(sqes_size, IORING_OFF_SQES);
+		if (!sq_ring || !cq_ring || !sqes_ptr) {
+			if (sqes_ptr) {
+				munmap(sqes_ptr, sqes_size);
+			}
+			Close();
+			return false;
+		}
+		sqes = reinterpret_cast<io_uring_sqe *>(sqes_ptr);
+		sq_head = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.head);
+		sq_tail = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.tail);
+		sq_mask = *reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.ring_mask);
+		sq_array = reinterpret_cast<uint32_t *>(sq_ring + params.sq_off.array);
+		cq_head = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.head);
+		cq_tail = reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.tail);
+		cq_mask = *reinterpret_cast<uint32_t *>(cq_ring + params.cq_off.ring_mask);
+		cqes = reinterpret_cast<io_uring_cqe *>(cq_ring + params.cq_off.cqes);
+		sq_entries = params.sq_entries;
+		cq_entries = params.cq_entries;
+		return true;
+	}
+
+	//! Submits all requests and waits for their completion. Requests that failed or were only partially read are
+	//! returned in "failed" so they can be retried with regular reads.
+	void Read(int fd, vector<FileReadRequest> &requests, vector<idx_t> &failed) {
+		vector<iovec> iovecs(requests.size());
+		idx_t submitted = 0;
+		idx_t completed = 0;
+		while (completed < requests.size()) {
+			// fill up the submission queue - we are the only producer, so the tail can be read without ordering
+			auto tail = *sq_tail;
+			auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+			while (submitted < requests.size() && tail - head < sq_entries && submitted - completed < cq_entries) {
+				auto &request = requests[submitted];
+				iovecs[submitted].iov_base = request.buffer;
+				iovecs[submitted].iov_len = NumericCast<size_t>(request.nr_bytes);
+
+				auto index = tail & sq_mask;
+				auto &sqe = sqes[index];
+				memset(&sqe, 0, sizeof(sqe));
+				sqe.opcode = IORING_OP_READV;
+				sqe.fd = fd;
+				sqe.addr = reinterpret_cast<uint64_t>(&iovecs[submitted]);
+				sqe.len = 1;
+				sqe.off = request.location;
+				sqe.user_data = submitted;
+				sq_array[index] = index;
+				tail++;
+				submitted++;
+			}
+			__atomic_store_n(sq_tail, tail, __ATOMIC_RELEASE);
+
+			// submit everything the kernel has not consumed yet, and wait for at least one completion
+			auto to_submit = tail - __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+			auto rc = syscall(__NR_io_uring_enter, ring_fd, to_submit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				auto error = errno;
+				// the reads in flight point into the iovecs and the buffers of the caller: wait for them before
+				// throwing, so that the kernel does not write into freed memory or leave completions for a later batch
+				Drain(submitted - completed);
+				throw IOException("Could not submit reads to io_uring: %s", {{"errno", std::to_string(error)}},
+				                  strerror(error));
+			}
+			completed += ReapCompletions(&requests, &failed);
+		}
+	}
+
+	//! Whether the ring can be used, it is closed if the reads in flight could not be waited for after an error
+	bool IsOpen() const {
+		return ring_fd >= 0;
+	}
+
+private:
+	//! Reaps the available completions, adding the requests that failed or were only partially read to "failed".
+	//! Returns the amount of completions.
+	idx_t ReapCompletions(optional_ptr<vector<FileReadRequest>> requests, optional_ptr<vector<idx_t>> failed) {
+		idx_t count = 0;
+		auto head_index = *cq_head;
+		auto tail_index = __atomic_load_n(cq_tail, __ATOMIC_ACQUIRE);
+		for (; head_index != tail_index; head_index++) {
+			auto &cqe = cqes[head_index & cq_mask];
+			if (requests) {
+				auto request_idx = NumericCast<idx_t>(cqe.user_data);
+				D_ASSERT(request_idx < requests->size());
+				if (cqe.res != (*requests)[request_idx].nr_bytes) {
+					failed->push_back(request_idx);
+				}
+			}
+			count++;
+		}
+		__atomic_store_n(cq_head, head_index, __ATOMIC_RELEASE);
+		return count;
+	}
+
+	//! Drops the submissions that the kernel has not consumed yet, and waits for the completion of all other
+	//! outstanding reads. Closes the ring if that fails, as its completions could no longer be matched to requests.
+	void Drain(idx_t outstanding) {
+		// we are the only producer and the kernel only consumes submissions in io_uring_enter: retract the rest
+		auto head = __atomic_load_n(sq_head, __ATOMIC_ACQUIRE);
+		auto unconsumed = *sq_tail - head;
+		__atomic_store_n(sq_tail, head, __ATOMIC_RELEASE);
+		outstanding -= MinValue<idx_t>(outstanding, unconsumed);
+
+		outstanding -= MinValue<idx_t>(outstanding, ReapCompletions(nullptr, nullptr));
+		while (outstanding > 0) {
+			auto wait_count = NumericCast<uint32_t>(outstanding);
+			auto rc = syscall(__NR_io_uring_enter, ring_fd, 0, wait_count, IORING_ENTER_GETEVENTS, nullptr, 0);
+			if (rc < 0 && errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				// closing the ring makes the kernel cancel the remaining reads
+				Close();
+				return;
+			}
+			outstanding -= MinValue<idx_t>(outstanding, ReapCompletions(nullptr, nullptr));
+		}
+	}
+
+	data_ptr_t Map(size_t size, off_t offset) {
+		auto result = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd, offset);
+		return result == MAP_FAILED ? nullptr : static_cast<data_ptr_t>(result);
+	}
+
+	void Close() {
+		if (sqes) {
+			munmap(sqes, sqes_size);
+			sqes = nullptr;
+		}
+		if (cq_ring && cq_ring != sq_ring) {
+			munmap(cq_ring, cq_ring_size);
+		}
+		if (sq_ring) {
+			munmap(sq_ring, sq_ring_size);
+		}
+		sq_ring = nullptr;
+		cq_ring = nullptr;
+		if (ring_fd >= 0) {
+			close(ring_fd);
+			ring_fd = -1;
+		}
+	}
+
+private:
+	int ring_fd = -1;
+	data_ptr_t sq_ring = nullptr;
+	data_ptr_t cq_ring = nullptr;
+	size_t sq_ring_size = 0;
+	size_t cq_ring_size = 0;
+	size_t sqes_size = 0;
+	io_uring_sqe *sqes = nullptr;
+	io_uring_cqe *cqes = nullptr;
+	uint32_t *sq_head = nullptr;
+	uint32_t *sq_tail = nullptr;
+	uint32_t *sq_array = nullptr;
+	uint32_t sq_mask = 0;
+	uint32_t *cq_head = nullptr;
+	uint32_t *cq_tail = nullptr;
+	uint32_t cq_mask = 0;
+	uint32_t sq_entries = 0;
+	uint32_t cq_entries = 0;
+};
+
+//! Set once io_uring could not be set up (e.g. because it is not supported or disabled by the kernel)
+static atomic<bool> io_uring_unavailable {false};
+
+//! Every thread gets its own ring, so submissions never have to be synchronized
+static optional_ptr<IOUring> GetThreadIOUring() {
+	thread_local unique_ptr<IOUring> ring;
+	if (ring && ring->IsOpen()) {
+		return ring.get();
+	}
+	if (io_uring_unavailable) {
+		return nullptr;
+	}
+	auto new_ring = make_uniq<IOUring>();
+	if (!new_ring->Open()) {
+		io_uring_unavailable = true;
+		return nullptr;
+	}
+	ring = std::move(new_ring);
+	return ring.get();
+}
+#endif
+
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+#ifdef DUCKDB_HAS_IO_URING
+	auto ring = requests.size() > 1 ? GetThreadIOUring() : nullptr;
+	if (ring) {
+		int fd = handle.Cast<UnixFileHandle>().fd;
+		vector<idx_t> failed;
+		ring->Read(fd, requests, failed);
+		// retry failed or short reads with pread, which throws an appropriate error if they fail again
+		for (auto &request_idx : failed) {
+			auto &request = requests[request_idx];
+			Read(handle, request.buffer, request.nr_bytes, request.location);
+		}
+		return;
+	}
+#endif
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	int fd = handle.Cast<UnixFileHandle>().fd;
 	int64_t bytes_read = read(fd, buffer, UnsafeNumericCast<size_t>(nr_bytes));
@@ -875,6 +1122,10 @@ void LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes, i
 	}
 }
 
+void LocalFileSystem::ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) {
+	FileSystem::ReadBatch(handle, requests);
+}
+
 int64_t LocalFileSystem::Read(FileHandle &handle, void *buffer, int64_t nr_bytes) {
 	HANDLE hFile = handle.Cast<WindowsFileHandle>().fd;
 	auto &pos = handle.Cast<WindowsFileHandle>().position;
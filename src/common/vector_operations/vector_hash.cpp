@@ -61,6 +61,61 @@ static inline void TemplatedLoopHash(Vector &input, Vector &result, const Select
 	}
 }
 
+//! Hashes the entries of the dictionary of a dictionary vector, if there are fewer entries than rows
+static inline bool TryHashDictionary(Vector &input, Vector &dictionary_hashes, idx_t count) {
+	if (input.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto dictionary_size = DictionaryVector::DictionarySize(input);
+	if (!dictionary_size.IsValid() || dictionary_size.GetIndex() >= count) {
+		return false;
+	}
+	auto &dictionary = DictionaryVector::Child(input);
+	dictionary_hashes.Initialize(false, dictionary_size.GetIndex());
+	VectorOperations::Hash(dictionary, dictionary_hashes, dictionary_size.GetIndex());
+	dictionary_hashes.Flatten(dictionary_size.GetIndex());
+	return true;
+}
+
+template <bool HAS_RSEL>
+static inline bool TryDictionaryLoopHash(Vector &input, Vector &result, const SelectionVector *rsel, idx_t count) {
+	Vector dictionary_hashes(LogicalType::HASH, nullptr);
+	if (!TryHashDictionary(input, dictionary_hashes, count)) {
+		return false;
+	}
+	auto dictionary_hash_data = FlatVector::GetData<hash_t>(dictionary_hashes);
+	auto &sel = DictionaryVector::SelVector(input);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<hash_t>(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		result_data[ridx] = dictionary_hash_data[sel.get_index(ridx)];
+	}
+	return true;
+}
+
+template <bool HAS_RSEL>
+static inline bool TryDictionaryLoopCombineHash(Vector &input, Vector &hashes, const SelectionVector *rsel,
+                                                idx_t count) {
+	if (hashes.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	Vector dictionary_hashes(LogicalType::HASH, nullptr);
+	if (!TryHashDictionary(input, dictionary_hashes, count)) {
+		return false;
+	}
+	auto dictionary_hash_data = FlatVector::GetData<hash_t>(dictionary_hashes);
+	auto &sel = DictionaryVector::SelVector(input);
+
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+	for (idx_t i = 0; i < count; i++) {
+		auto ridx = HAS_RSEL ? rsel->get_index(i) : i;
+		hash_data[ridx] = CombineHashScalar(hash_data[ridx], dictionary_hash_data[sel.get_index(ridx)]);
+	}
+	return true;
+}
+
 template <bool HAS_RSEL, bool FIRST_HASH>
 static inline void StructLoopHash(Vector &input, Vector &hashes, const SelectionVector *rsel, idx_t count) {
 	auto &children = StructVector::GetEntries(input);
@@ -291,7 +346,10 @@ static inline void HashTypeSwitch(Vector &input, Vector &result, const Selection
 		TemplatedLoopHash<HAS_RSEL, interval_t>(input, result, rsel, count);
 		break;
 	case PhysicalType::VARCHAR:
-		TemplatedLoopHash<HAS_RSEL, string_t>(input, result, rsel, count);
+		// strings are expensive to hash: hash each entry of a dictionary once
+		if (!TryDictionaryLoopHash<HAS_RSEL>(input, result, rsel, count)) {
+			TemplatedLoopHash<HAS_RSEL, string_t>(input, result, rsel, count);
+		}
 		break;
 	case PhysicalType::STRUCT:
 		StructLoopHash<HAS_RSEL, true>(input, result, rsel, count);
@@ -430,7 +488,9 @@ static inline void CombineHashTypeSwitch(Vector &hashes, Vector &input, const Se
 		TemplatedLoopCombineHash<HAS_RSEL, interval_t>(input, hashes, rsel, count);
 		break;
 	case PhysicalType::VARCHAR:
-		TemplatedLoopCombineHash<HAS_RSEL, string_t>(input, hashes, rsel, count);
+		if (!TryDictionaryLoopCombineHash<HAS_RSEL>(input, hashes, rsel, count)) {
+			TemplatedLoopCombineHash<HAS_RSEL, string_t>(input, hashes, rsel, count);
+		}
 		break;
 	case PhysicalType::STRUCT:
 		StructLoopHash<HAS_RSEL, false>(input, hashes, rsel, count);
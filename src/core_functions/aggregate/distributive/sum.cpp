@@ -19,8 +19,14 @@ struct SumSetOperation {
 	static void AddValues(STATE &state, idx_t count) {
 		state.isset = true;
 	}
+	template <class STATE>
+	static void RemoveValues(STATE &state, idx_t count) {
+	}
 };
 
+using IntegerSumRemoveOperation = BaseSumRemoveOperation<SumSetOperation, RegularSubtract>;
+using HugeintSumRemoveOperation = BaseSumRemoveOperation<SumSetOperation, HugeintSubtract>;
+
 struct IntegerSumOperation : public BaseSumOperation<SumSetOperation, RegularAdd> {
 	template <class T, class STATE>
 	static void Finalize(STATE &state, T &target, AggregateFinalizeData &finalize_data) {
@@ -89,6 +95,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int32_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.remove = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int32_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
@@ -99,6 +106,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int64_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
+		function.remove = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int64_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
@@ -158,6 +166,7 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
+		function.remove = AggregateFunction::UnaryScatterUpdate<SumState<int64_t>, int16_t, IntegerSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
@@ -166,6 +175,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int32_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
+		function.remove =
+		    AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, int32_t, HugeintSumRemoveOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -174,6 +185,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, int64_t, hugeint_t, SumToHugeintOperation>(
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
+		function.remove =
+		    AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, int64_t, HugeintSumRemoveOperation>;
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
@@ -182,6 +195,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function =
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
+		function.remove =
+		    AggregateFunction::UnaryScatterUpdate<SumState<hugeint_t>, hugeint_t, HugeintSumRemoveOperation>;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
 		return function;
 	}
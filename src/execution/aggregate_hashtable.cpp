@@ -41,7 +41,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), skip_lookups(false), count(0), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -166,6 +167,15 @@ void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
 
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	D_ASSERT(!skip_lookups_p || Count() == 0);
+	skip_lookups = skip_lookups_p;
+}
+
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::Resize(idx_t size) {
 	D_ASSERT(size >= STANDARD_VECTOR_SIZE);
 	D_ASSERT(IsPowerOfTwo(size));
@@ -314,7 +324,7 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
 	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -326,20 +336,6 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	addresses_v.Flatten(groups.size());
 	auto addresses = FlatVector::GetData<data_ptr_t>(addresses_v);
 
-	// Compute the entry in the table based on the hash using a modulo,
-	// and precompute the hash salts for faster comparison below
-	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
-	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
-	for (idx_t r = 0; r < groups.size(); r++) {
-		const auto &hash = hashes[r];
-		ht_offsets[r] = ApplyBitMask(hash);
-		D_ASSERT(ht_offsets[r] == hash % capacity);
-		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
-	}
-
-	// we start out with all entries [0, 1, 2, ..., groups.size()]
-	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
-
 	// Make a chunk that references the groups and the hashes and convert to unified format
 	if (state.group_chunk.ColumnCount() == 0) {
 		state.group_chunk.InitializeEmpty(layout.GetTypes());
@@ -359,6 +355,35 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Append every row as a new group without touching the pointer table, duplicates are combined later
+		const auto &all_rows = *FlatVector::IncrementalSelectionVector();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, all_rows, groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, all_rows, groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		return groups.size();
+	}
+
+	// Compute the entry in the table based on the hash using a modulo,
+	// and precompute the hash salts for faster comparison below
+	auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
+	const auto hash_salts = FlatVector::GetData<hash_t>(state.hash_salts);
+	for (idx_t r = 0; r < groups.size(); r++) {
+		const auto &hash = hashes[r];
+		ht_offsets[r] = ApplyBitMask(hash);
+		D_ASSERT(ht_offsets[r] == hash % capacity);
+		hash_salts[r] = ht_entry_t::ExtractSalt(hash);
+	}
+
+	// we start out with all entries [0, 1, 2, ..., groups.size()]
+	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -16,10 +16,14 @@
 #include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/optimizer/matcher/expression_matcher.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 
 namespace duckdb {
 
 struct ARTIndexScanState : public IndexScanState {
+	ARTIndexScanState() : arena_allocator(Allocator::DefaultAllocator()) {
+	}
 
 	//! Scan predicates (single predicate scan or range scan)
 	Value values[2];
@@ -29,8 +33,18 @@ struct ARTIndexScanState : public IndexScanState {
 	//! All scanned row IDs
 	vector<row_t> result_ids;
 	Iterator iterator;
+
+	//! Keys of point lookups or prefix scans, e.g., for IN lists or compound keys
+	vector<ARTKey> probe_keys;
+	//! True, if the probe keys are key prefixes, and false, if they are full keys
+	bool prefix_probes = false;
+	//! Holds the data of the probe keys
+	ArenaAllocator arena_allocator;
 };
 
+//! The maximum number of point lookups or prefix scans of a single index scan
+static constexpr idx_t ART_MAX_PROBE_KEYS = 4096;
+
 //===--------------------------------------------------------------------===//
 // ART
 //===--------------------------------------------------------------------===//
@@ -122,6 +136,152 @@ static unique_ptr<IndexScanState> InitializeScanTwoPredicates(const Transaction
 	return std::move(result);
 }
 
+static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value) {
+	D_ASSERT(type == value.type().InternalType());
+	switch (type) {
+	case PhysicalType::BOOL:
+		return ARTKey::CreateARTKey<bool>(allocator, value.type(), value);
+	case PhysicalType::INT8:
+		return ARTKey::CreateARTKey<int8_t>(allocator, value.type(), value);
+	case PhysicalType::INT16:
+		return ARTKey::CreateARTKey<int16_t>(allocator, value.type(), value);
+	case PhysicalType::INT32:
+		return ARTKey::CreateARTKey<int32_t>(allocator, value.type(), value);
+	case PhysicalType::INT64:
+		return ARTKey::CreateARTKey<int64_t>(allocator, value.type(), value);
+	case PhysicalType::UINT8:
+		return ARTKey::CreateARTKey<uint8_t>(allocator, value.type(), value);
+	case PhysicalType::UINT16:
+		return ARTKey::CreateARTKey<uint16_t>(allocator, value.type(), value);
+	case PhysicalType::UINT32:
+		return ARTKey::CreateARTKey<uint32_t>(allocator, value.type(), value);
+	case PhysicalType::UINT64:
+		return ARTKey::CreateARTKey<uint64_t>(allocator, value.type(), value);
+	case PhysicalType::INT128:
+		return ARTKey::CreateARTKey<hugeint_t>(allocator, value.type(), value);
+	case PhysicalType::UINT128:
+		return ARTKey::CreateARTKey<uhugeint_t>(allocator, value.type(), value);
+	case PhysicalType::FLOAT:
+		return ARTKey::CreateARTKey<float>(allocator, value.type(), value);
+	case PhysicalType::DOUBLE:
+		return ARTKey::CreateARTKey<double>(allocator, value.type(), value);
+	case PhysicalType::VARCHAR:
+		return ARTKey::CreateARTKey<string_t>(allocator, value.type(), value);
+	default:
+		throw InternalException("Invalid type for the ART key");
+	}
+}
+
+//! Returns true, if the filter is a prefix filter (e.g., LIKE 'abc%') on the index expression, and sets the prefix
+static bool GetPrefixConstant(const Expression &index_expr, const Expression &filter_expr, string &prefix) {
+	if (filter_expr.type != ExpressionType::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &function = filter_expr.Cast<BoundFunctionExpression>();
+	if (function.function.name != "prefix" || function.children.size() != 2) {
+		return false;
+	}
+	if (!function.children[0]->Equals(index_expr) || function.children[0]->return_type != LogicalType::VARCHAR) {
+		return false;
+	}
+	if (function.children[1]->type != ExpressionType::VALUE_CONSTANT) {
+		return false;
+	}
+	auto &value = function.children[1]->Cast<BoundConstantExpression>().value;
+	if (value.IsNull() || value.type() != LogicalType::VARCHAR) {
+		return false;
+	}
+	prefix = StringValue::Get(value);
+	// an empty prefix matches all keys
+	return !prefix.empty();
+}
+
+unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction,
+                                                  const vector<unique_ptr<Expression>> &index_exprs,
+                                                  const vector<unique_ptr<Expression>> &filter_exprs) {
+
+	D_ASSERT(index_exprs.size() == types.size());
+	auto result = make_uniq<ARTIndexScanState>();
+	auto &allocator = result->arena_allocator;
+	auto &keys = result->probe_keys;
+
+	// find the longest sequence of leading key columns that have an equality or IN filter,
+	// and create the (compound) keys of all value combinations
+	idx_t column_count = 0;
+	for (; column_count < index_exprs.size(); column_count++) {
+		auto &index_expr = *index_exprs[column_count];
+		auto type = types[column_count];
+
+		vector<Value> constants;
+		for (auto &filter_expr : filter_exprs) {
+			if (BoundIndex::GetEqualityConstants(index_expr, *filter_expr, type, constants)) {
+				break;
+			}
+		}
+		auto probe_count = column_count == 0 ? constants.size() : keys.size() * constants.size();
+		if (constants.empty() || probe_count > ART_MAX_PROBE_KEYS) {
+			break;
+		}
+
+		if (column_count == 0) {
+			for (auto &constant : constants) {
+				keys.push_back(CreateKey(allocator, type, constant));
+			}
+			continue;
+		}
+		vector<ARTKey> compound_keys;
+		for (auto &key : keys) {
+			for (auto &constant : constants) {
+				auto compound_key = key;
+				auto other_key = CreateKey(allocator, type, constant);
+				compound_key.ConcatenateARTKey(allocator, other_key);
+				compound_keys.push_back(compound_key);
+			}
+		}
+		keys = std::move(compound_keys);
+	}
+
+	if (column_count == index_exprs.size()) {
+		// we know the full keys: point lookups
+		return std::move(result);
+	}
+
+	// the keys are prefixes of the full keys, which we can extend with a string prefix on the next key column
+	result->prefix_probes = true;
+	string prefix;
+	for (auto &filter_expr : filter_exprs) {
+		if (!GetPrefixConstant(*index_exprs[column_count], *filter_expr, prefix)) {
+			continue;
+		}
+		// the key of a string ends with a NULL-terminator, which we remove to get the key prefix
+		auto prefix_key = ARTKey::CreateARTKey<string_t>(allocator, LogicalType::VARCHAR, string_t(prefix));
+		prefix_key.len--;
+		if (keys.empty()) {
+			keys.push_back(prefix_key);
+			break;
+		}
+		for (auto &key : keys) {
+			key.ConcatenateARTKey(allocator, prefix_key);
+		}
+		break;
+	}
+	if (!keys.empty()) {
+		return std::move(result);
+	}
+
+	// range predicates on a single key column
+	if (index_exprs.size() != 1) {
+		return nullptr;
+	}
+	for (auto &filter_expr : filter_exprs) {
+		auto index_state = TryInitializeScan(transaction, *index_exprs[0], *filter_expr);
+		if (index_state) {
+			return index_state;
+		}
+	}
+	return nullptr;
+}
+
 unique_ptr<IndexScanState> ART::TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
                                                   const Expression &filter_expr) {
 
@@ -471,13 +631,10 @@ bool ConstructInternal(ART &art, vector<ARTKey> &keys, const row_t *row_ids, Nod
 	return true;
 }
 
-bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers) {
+bool ART::ConstructFromSorted(vector<ARTKey> &keys, const row_t *row_ids, const idx_t start, const idx_t count) {
 
-	UnifiedVectorFormat row_id_data;
-	row_identifiers.ToUnifiedFormat(count, row_id_data);
-	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
-
-	auto key_section = KeySection(0, count - 1, 0, 0);
+	D_ASSERT(count > 0 && start + count <= keys.size());
+	auto key_section = KeySection(start, start + count - 1, 0, 0);
 	auto has_constraint = IsUnique();
 	if (!ConstructInternal(*this, keys, row_ids, tree, key_section, has_constraint)) {
 		return false;
@@ -485,7 +642,7 @@ bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_ide
 
 #ifdef DEBUG
 	D_ASSERT(!VerifyAndToStringInternal(true).empty());
-	for (idx_t i = 0; i < count; i++) {
+	for (idx_t i = start; i < start + count; i++) {
 		D_ASSERT(!keys[i].Empty());
 		auto leaf = Lookup(tree, keys[i], 0);
 		D_ASSERT(Leaf::ContainsRowId(*this, *leaf, row_ids[i]));
@@ -538,6 +695,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers
 	}
 
 	if (failed_index != DConstants::INVALID_INDEX) {
+		UnpinBuffers();
 		return ErrorData(ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicate key \"%s\"",
 		                                     AppendRowError(input, failed_index)));
 	}
@@ -553,6 +711,7 @@ ErrorData ART::Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers
 	}
 #endif
 
+	UnpinBuffers();
 	return ErrorData();
 }
 
@@ -705,6 +864,8 @@ void ART::Delete(IndexLock &state, DataChunk &input, Vector &row_identifiers) {
 		}
 	}
 #endif
+
+	UnpinBuffers();
 }
 
 void ART::Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id) {
@@ -762,42 +923,6 @@ void ART::Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id)
 // Point Query (Equal)
 //===--------------------------------------------------------------------===//
 
-static ARTKey CreateKey(ArenaAllocator &allocator, PhysicalType type, Value &value) {
-	D_ASSERT(type == value.type().InternalType());
-	switch (type) {
-	case PhysicalType::BOOL:
-		return ARTKey::CreateARTKey<bool>(allocator, value.type(), value);
-	case PhysicalType::INT8:
-		return ARTKey::CreateARTKey<int8_t>(allocator, value.type(), value);
-	case PhysicalType::INT16:
-		return ARTKey::CreateARTKey<int16_t>(allocator, value.type(), value);
-	case PhysicalType::INT32:
-		return ARTKey::CreateARTKey<int32_t>(allocator, value.type(), value);
-	case PhysicalType::INT64:
-		return ARTKey::CreateARTKey<int64_t>(allocator, value.type(), value);
-	case PhysicalType::UINT8:
-		return ARTKey::CreateARTKey<uint8_t>(allocator, value.type(), value);
-	case PhysicalType::UINT16:
-		return ARTKey::CreateARTKey<uint16_t>(allocator, value.type(), value);
-	case PhysicalType::UINT32:
-		return ARTKey::CreateARTKey<uint32_t>(allocator, value.type(), value);
-	case PhysicalType::UINT64:
-		return ARTKey::CreateARTKey<uint64_t>(allocator, value.type(), value);
-	case PhysicalType::INT128:
-		return ARTKey::CreateARTKey<hugeint_t>(allocator, value.type(), value);
-	case PhysicalType::UINT128:
-		return ARTKey::CreateARTKey<uhugeint_t>(allocator, value.type(), value);
-	case PhysicalType::FLOAT:
-		return ARTKey::CreateARTKey<float>(allocator, value.type(), value);
-	case PhysicalType::DOUBLE:
-		return ARTKey::CreateARTKey<double>(allocator, value.type(), value);
-	case PhysicalType::VARCHAR:
-		return ARTKey::CreateARTKey<string_t>(allocator, value.type(), value);
-	default:
-		throw InternalException("Invalid type for the ART key");
-	}
-}
-
 bool ART::SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids) {
 
 	auto leaf = Lookup(tree, key, 0);
@@ -845,6 +970,85 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 	return nullptr;
 }
 
+void ART::LookupBatch(const vector<ARTKey> &keys, const idx_t count, vector<optional_ptr<const Node>> &leaves) {
+
+	leaves.assign(count, nullptr);
+
+	// sort the (non-empty) keys, so that consecutive keys share as much of their traversal as possible
+	vector<idx_t> order;
+	order.reserve(count);
+	for (idx_t i = 0; i < count; i++) {
+		if (!keys[i].Empty()) {
+			order.push_back(i);
+		}
+	}
+	std::sort(order.begin(), order.end(), [&](const idx_t a, const idx_t b) { return keys[b] > keys[a]; });
+
+	// the nodes on the path of the previous key, and the depth at which we reached them
+	vector<pair<reference<const Node>, idx_t>> path;
+	optional_ptr<const ARTKey> previous_key;
+	optional_ptr<const Node> previous_leaf;
+
+	for (auto &idx : order) {
+		auto &key = keys[idx];
+
+		idx_t common_len = 0;
+		if (previous_key) {
+			auto max_len = MinValue(key.len, previous_key->len);
+			while (common_len < max_len && key[common_len] == (*previous_key)[common_len]) {
+				common_len++;
+			}
+			if (common_len == key.len && common_len == previous_key->len) {
+				// duplicate key
+				leaves[idx] = previous_leaf;
+				continue;
+			}
+		}
+		previous_key = &key;
+
+		// we reached a node of the path with the first 'depth' bytes of the previous key, so we reach the same node
+		// with the current key, if both keys share these bytes
+		while (!path.empty() && path.back().second > common_len) {
+			path.pop_back();
+		}
+		reference<const Node> node_ref(tree);
+		idx_t depth = 0;
+		if (!path.empty()) {
+			node_ref = path.back().first;
+			depth = path.back().second;
+			path.pop_back();
+		}
+
+		previous_leaf = nullptr;
+		while (node_ref.get().HasMetadata()) {
+			path.emplace_back(node_ref, depth);
+
+			// traverse prefix, if exists
+			reference<const Node> next_node(node_ref.get());
+			if (next_node.get().GetType() == NType::PREFIX) {
+				Prefix::Traverse(*this, next_node, key, depth);
+				if (next_node.get().GetType() == NType::PREFIX) {
+					break;
+				}
+			}
+
+			if (next_node.get().GetType() == NType::LEAF || next_node.get().GetType() == NType::LEAF_INLINED) {
+				previous_leaf = &next_node.get();
+				break;
+			}
+
+			D_ASSERT(depth < key.len);
+			auto child = next_node.get().GetChild(*this, key[depth]);
+			if (!child) {
+				break;
+			}
+			node_ref = *child;
+			depth++;
+		}
+		leaves[idx] = previous_leaf;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Greater Than and Less Than
 //===--------------------------------------------------------------------===//
@@ -915,6 +1119,59 @@ bool ART::SearchCloseRange(ARTIndexScanState &state, ARTKey &lower_bound, ARTKey
 	return it.Scan(upper_bound, max_count, result_ids, right_equal);
 }
 
+//! Lookups only read the ART, so they can pin on-disk buffers directly instead of loading them into memory.
+//! All buffers are unpinned once the lookup is done.
+class ARTReadOnlyScope {
+public:
+	explicit ARTReadOnlyScope(ART &art) : art(art) {
+		for (auto &allocator : *art.allocators) {
+			allocator->SetReadOnly(true);
+		}
+	}
+	~ARTReadOnlyScope() {
+		for (auto &allocator : *art.allocators) {
+			allocator->SetReadOnly(false);
+		}
+		art.UnpinBuffers();
+	}
+
+private:
+	ART &art;
+};
+
+//===--------------------------------------------------------------------===//
+// Prefix Query
+//===--------------------------------------------------------------------===//
+
+bool ART::SearchPrefix(ARTKey &prefix, idx_t max_count, vector<row_t> &result_ids) {
+
+	if (!tree.HasMetadata()) {
+		return true;
+	}
+
+	// all keys starting with the prefix are greater than or equal to the prefix, and less than the upper bound,
+	// which is the prefix with its last byte incremented, ignoring trailing 0xFF bytes
+	ArenaAllocator arena_allocator(Allocator::Get(db));
+	ARTKey upper_bound;
+	auto upper_bound_len = prefix.len;
+	while (upper_bound_len > 0 && prefix[upper_bound_len - 1] == NumericLimits<uint8_t>::Maximum()) {
+		upper_bound_len--;
+	}
+	if (upper_bound_len > 0) {
+		upper_bound = ARTKey(arena_allocator, upper_bound_len);
+		memcpy(upper_bound.data, prefix.data, upper_bound_len);
+		upper_bound[upper_bound_len - 1]++;
+	}
+
+	Iterator it;
+	it.art = this;
+	if (!it.LowerBound(tree, prefix, true, 0)) {
+		// early-out, if the maximum value in the ART is lower than the prefix
+		return true;
+	}
+	return it.Scan(upper_bound, max_count, result_ids, false);
+}
+
 bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
                vector<row_t> &result_ids) {
 
@@ -922,15 +1179,33 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	vector<row_t> row_ids;
 	bool success;
 
-	// FIXME: the key directly owning the data for a single key might be more efficient
-	D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
-	ArenaAllocator arena_allocator(Allocator::Get(db));
-	auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
+	if (!scan_state.probe_keys.empty()) {
+
+		// point lookups or prefix scans
+		lock_guard<mutex> l(lock);
+		ARTReadOnlyScope read_only_scope(*this);
+		success = true;
+		for (auto &probe_key : scan_state.probe_keys) {
+			if (scan_state.prefix_probes) {
+				success = SearchPrefix(probe_key, max_count, row_ids);
+			} else {
+				success = SearchEqual(probe_key, max_count, row_ids);
+			}
+			if (!success) {
+				break;
+			}
+		}
 
-	if (scan_state.values[1].IsNull()) {
+	} else if (scan_state.values[1].IsNull()) {
+
+		// FIXME: the key directly owning the data for a single key might be more efficient
+		D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
+		ArenaAllocator arena_allocator(Allocator::Get(db));
+		auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
 
 		// single predicate
 		lock_guard<mutex> l(lock);
+		ARTReadOnlyScope read_only_scope(*this);
 		switch (scan_state.expressions[0]) {
 		case ExpressionType::COMPARE_EQUAL:
 			success = SearchEqual(key, max_count, row_ids);
@@ -953,8 +1228,13 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 
 	} else {
 
+		D_ASSERT(scan_state.values[0].type().InternalType() == types[0]);
+		ArenaAllocator arena_allocator(Allocator::Get(db));
+		auto key = CreateKey(arena_allocator, types[0], scan_state.values[0]);
+
 		// two predicates
 		lock_guard<mutex> l(lock);
+		ARTReadOnlyScope read_only_scope(*this);
 
 		D_ASSERT(scan_state.values[1].type().InternalType() == types[0]);
 		auto upper_bound = CreateKey(arena_allocator, types[0], scan_state.values[1]);
@@ -989,56 +1269,11 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 // More Verification / Constraint Checking
 //===--------------------------------------------------------------------===//
 
-string ART::GenerateErrorKeyName(DataChunk &input, idx_t row) {
-
-	// FIXME: why exactly can we not pass the expression_chunk as an argument to this
-	// FIXME: function instead of re-executing?
-	// re-executing the expressions is not very fast, but we're going to throw, so we don't care
-	DataChunk expression_chunk;
-	expression_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
-	ExecuteExpressions(input, expression_chunk);
-
-	string key_name;
-	for (idx_t k = 0; k < expression_chunk.ColumnCount(); k++) {
-		if (k > 0) {
-			key_name += ", ";
-		}
-		key_name += unbound_expressions[k]->GetName() + ": " + expression_chunk.data[k].GetValue(row).ToString();
-	}
-	return key_name;
-}
-
-string ART::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, const string &key_name) {
-	switch (verify_type) {
-	case VerifyExistenceType::APPEND: {
-		// APPEND to PK/UNIQUE table, but node/key already exists in PK/UNIQUE table
-		string type = IsPrimary() ? "primary key" : "unique";
-		return StringUtil::Format("Duplicate key \"%s\" violates %s constraint. "
-		                          "If this is an unexpected constraint violation please double "
-		                          "check with the known index limitations section in our documentation "
-		                          "(https://duckdb.org/docs/sql/indexes).",
-		                          key_name, type);
-	}
-	case VerifyExistenceType::APPEND_FK: {
-		// APPEND_FK to FK table, node/key does not exist in PK/UNIQUE table
-		return StringUtil::Format(
-		    "Violates foreign key constraint because key \"%s\" does not exist in the referenced table", key_name);
-	}
-	case VerifyExistenceType::DELETE_FK: {
-		// DELETE_FK that still exists in a FK table, i.e., not a valid delete
-		return StringUtil::Format("Violates foreign key constraint because key \"%s\" is still referenced by a foreign "
-		                          "key in a different table",
-		                          key_name);
-	}
-	default:
-		throw NotImplementedException("Type not implemented for VerifyExistenceType");
-	}
-}
-
 void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
 
 	// don't alter the index during constraint checking
 	lock_guard<mutex> l(lock);
+	ARTReadOnlyScope read_only_scope(*this);
 
 	// first resolve the expressions for the index
 	DataChunk expression_chunk;
@@ -1049,6 +1284,10 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	vector<ARTKey> keys(expression_chunk.size());
 	GenerateKeys<>(arena_allocator, expression_chunk, keys);
 
+	// look up all keys at once
+	vector<optional_ptr<const Node>> leaves;
+	LookupBatch(keys, expression_chunk.size(), leaves);
+
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 
@@ -1059,7 +1298,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = leaves[i];
 		if (!leaf) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
@@ -1100,6 +1339,7 @@ IndexStorageInfo ART::GetStorageInfo(const bool get_buffers) {
 	if (!get_buffers) {
 		// store the data on disk as partial blocks and set the block ids
 		WritePartialBlocks();
+		UnpinBuffers();
 
 	} else {
 		// set the correct allocation sizes and get the map containing all buffers
@@ -1195,6 +1435,7 @@ void ART::Vacuum(IndexLock &state) {
 		}
 	}
 	if (!perform_vacuum) {
+		UnpinBuffers();
 		return;
 	}
 
@@ -1203,6 +1444,7 @@ void ART::Vacuum(IndexLock &state) {
 
 	// finalize the vacuum operation
 	FinalizeVacuum(flags);
+	UnpinBuffers();
 }
 
 //===--------------------------------------------------------------------===//
@@ -1220,6 +1462,12 @@ idx_t ART::GetInMemorySize(IndexLock &index_lock) {
 	return in_memory_size;
 }
 
+void ART::UnpinBuffers() {
+	for (auto &allocator : *allocators) {
+		allocator->Unpin();
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Merging
 //===--------------------------------------------------------------------===//
@@ -1256,10 +1504,9 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 	}
 
 	// merge the ARTs
-	if (!tree.Merge(*this, other_art.tree)) {
-		return false;
-	}
-	return true;
+	auto success = tree.Merge(*this, other_art.tree);
+	UnpinBuffers();
+	return success;
 }
 
 //===--------------------------------------------------------------------===//
@@ -1270,7 +1517,9 @@ string ART::VerifyAndToString(IndexLock &state, const bool only_verify) {
 	// FIXME: this can be improved by counting the allocations of each node type,
 	// FIXME: and by asserting that each fixed-size allocator lists an equal number of
 	// FIXME: allocations of that type
-	return VerifyAndToStringInternal(only_verify);
+	auto result = VerifyAndToStringInternal(only_verify);
+	UnpinBuffers();
+	return result;
 }
 
 string ART::VerifyAndToStringInternal(const bool only_verify) {
@@ -115,6 +115,12 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 		return true;
 	}
 
+	// the key is a prefix of all keys in this subtree, which are therefore greater than (or equal to) the key
+	if (depth >= key.len) {
+		FindMinimum(node);
+		return true;
+	}
+
 	if (node.GetType() != NType::PREFIX) {
 		auto next_byte = key[depth];
 		auto child = node.GetNextChild(*art, next_byte);
@@ -145,6 +151,10 @@ bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal,
 	nodes.emplace(node, 0);
 
 	for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+		if (depth + i >= key.len) {
+			FindMinimum(prefix.ptr);
+			return true;
+		}
 		// the key down to this node is less than the lower bound, the next key will be
 		// greater than the lower bound
 		if (prefix.data[i] < key[depth + i]) {
@@ -0,0 +1,66 @@
+#include "duckdb/execution/index/bloom_index.hpp"
+
+#include "duckdb/storage/index_storage_info.hpp"
+
+namespace duckdb {
+
+BloomIndex::BloomIndex(const string &name, const IndexConstraintType index_constraint_type,
+                       const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                       const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db)
+    : BoundIndex(name, BloomIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager,
+                 unbound_expressions, db),
+      in_memory_size(0) {
+}
+
+ErrorData BloomIndex::Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) {
+	return ErrorData();
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk) {
+}
+
+void BloomIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+}
+
+void BloomIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+}
+
+void BloomIndex::CommitDrop(IndexLock &index_lock) {
+	// the Bloom filters of the row groups are no longer written in the next checkpoint
+}
+
+void BloomIndex::Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) {
+	// deleted values can stay in the Bloom filters: they only make the filters less selective
+}
+
+ErrorData BloomIndex::Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) {
+	return ErrorData();
+}
+
+bool BloomIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+	return true;
+}
+
+void BloomIndex::Vacuum(IndexLock &state) {
+}
+
+idx_t BloomIndex::GetInMemorySize(IndexLock &index_lock) {
+	return in_memory_size;
+}
+
+string BloomIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+	return only_verify ? string() : "Bloom filter index on " + to_string(column_ids.size()) + " column(s)";
+}
+
+IndexStorageInfo BloomIndex::GetStorageInfo(const bool get_buffers) {
+	return IndexStorageInfo(name);
+}
+
+string BloomIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                 DataChunk &input) {
+	throw InternalException("Bloom filter indexes do not enforce constraints");
+}
+
+constexpr const char *BloomIndex::TYPE_NAME;
+
+} // namespace duckdb
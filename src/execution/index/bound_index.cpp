@@ -2,7 +2,11 @@
 
 #include "duckdb/common/radix.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+#include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -112,4 +116,95 @@ string BoundIndex::AppendRowError(DataChunk &input, idx_t index) {
 	return error;
 }
 
+string BoundIndex::GenerateErrorKeyName(DataChunk &input, idx_t row) {
+
+	// FIXME: why exactly can we not pass the expression_chunk as an argument to this
+	// FIXME: function instead of re-executing?
+	// re-executing the expressions is not very fast, but we're going to throw, so we don't care
+	DataChunk expression_chunk;
+	expression_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expression_chunk);
+
+	string key_name;
+	for (idx_t k = 0; k < expression_chunk.ColumnCount(); k++) {
+		if (k > 0) {
+			key_name += ", ";
+		}
+		key_name += unbound_expressions[k]->GetName() + ": " + expression_chunk.data[k].GetValue(row).ToString();
+	}
+	return key_name;
+}
+
+string BoundIndex::GenerateConstraintErrorMessage(VerifyExistenceType verify_type, const string &key_name) {
+	switch (verify_type) {
+	case VerifyExistenceType::APPEND: {
+		// APPEND to PK/UNIQUE table, but node/key already exists in PK/UNIQUE table
+		string type = IsPrimary() ? "primary key" : "unique";
+		return StringUtil::Format("Duplicate key \"%s\" violates %s constraint. "
+		                          "If this is an unexpected constraint violation please double "
+		                          "check with the known index limitations section in our documentation "
+		                          "(https://duckdb.org/docs/sql/indexes).",
+		                          key_name, type);
+	}
+	case VerifyExistenceType::APPEND_FK: {
+		// APPEND_FK to FK table, node/key does not exist in PK/UNIQUE table
+		return StringUtil::Format(
+		    "Violates foreign key constraint because key \"%s\" does not exist in the referenced table", key_name);
+	}
+	case VerifyExistenceType::DELETE_FK: {
+		// DELETE_FK that still exists in a FK table, i.e., not a valid delete
+		return StringUtil::Format("Violates foreign key constraint because key \"%s\" is still referenced by a foreign "
+		                          "key in a different table",
+		                          key_name);
+	}
+	default:
+		throw NotImplementedException("Type not implemented for VerifyExistenceType");
+	}
+}
+
+bool BoundIndex::GetEqualityConstants(const Expression &index_expr, const Expression &filter_expr, PhysicalType type,
+                                       vector<Value> &constants) {
+	if (filter_expr.type == ExpressionType::COMPARE_EQUAL) {
+		auto &comparison = filter_expr.Cast<BoundComparisonExpression>();
+		auto left_is_input = comparison.left->Equals(index_expr);
+		auto &input = left_is_input ? comparison.left : comparison.right;
+		auto &constant = left_is_input ? comparison.right : comparison.left;
+		if (!input->Equals(index_expr) || constant->type != ExpressionType::VALUE_CONSTANT) {
+			return false;
+		}
+		auto &value = constant->Cast<BoundConstantExpression>().value;
+		if (value.type().InternalType() != type) {
+			return false;
+		}
+		if (!value.IsNull()) {
+			constants.push_back(value);
+		}
+		return true;
+	}
+
+	if (filter_expr.type == ExpressionType::COMPARE_IN) {
+		auto &in_expr = filter_expr.Cast<BoundOperatorExpression>();
+		if (!in_expr.children[0]->Equals(index_expr)) {
+			return false;
+		}
+		vector<Value> in_constants;
+		for (idx_t i = 1; i < in_expr.children.size(); i++) {
+			auto &child = *in_expr.children[i];
+			if (child.type != ExpressionType::VALUE_CONSTANT) {
+				return false;
+			}
+			auto &value = child.Cast<BoundConstantExpression>().value;
+			if (value.type().InternalType() != type) {
+				return false;
+			}
+			if (!value.IsNull()) {
+				in_constants.push_back(value);
+			}
+		}
+		constants.insert(constants.end(), in_constants.begin(), in_constants.end());
+		return true;
+	}
+	return false;
+}
+
 } // namespace duckdb
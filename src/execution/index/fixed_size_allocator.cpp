@@ -6,7 +6,7 @@ namespace duckdb {
 
 FixedSizeAllocator::FixedSizeAllocator(const idx_t segment_size, BlockManager &block_manager)
     : block_manager(block_manager), buffer_manager(block_manager.buffer_manager), segment_size(segment_size),
-      total_segment_count(0) {
+      total_segment_count(0), read_only(false) {
 
 	if (segment_size > block_manager.GetBlockSize() - sizeof(validity_t)) {
 		throw InternalException("The maximum segment size of fixed-size allocators is " +
@@ -53,6 +53,7 @@ IndexPointer FixedSizeAllocator::New() {
 		FixedSizeBuffer new_buffer(block_manager);
 		buffers.insert(make_pair(buffer_id, std::move(new_buffer)));
 		buffers_with_free_space.insert(buffer_id);
+		pinned_buffers.push_back(buffer_id);
 
 		// set the bitmask
 		D_ASSERT(buffers.find(buffer_id) != buffers.end());
@@ -73,8 +74,7 @@ IndexPointer FixedSizeAllocator::New() {
 	D_ASSERT(!buffers_with_free_space.empty());
 	auto buffer_id = uint32_t(*buffers_with_free_space.begin());
 
-	D_ASSERT(buffers.find(buffer_id) != buffers.end());
-	auto &buffer = buffers.find(buffer_id)->second;
+	auto &buffer = GetBuffer(buffer_id);
 	auto offset = buffer.GetOffset(bitmask_count);
 
 	total_segment_count++;
@@ -96,8 +96,7 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 	auto buffer_id = ptr.GetBufferId();
 	auto offset = ptr.GetOffset();
 
-	D_ASSERT(buffers.find(buffer_id) != buffers.end());
-	auto &buffer = buffers.find(buffer_id)->second;
+	auto &buffer = GetBuffer(buffer_id);
 
 	auto bitmask_ptr = reinterpret_cast<validity_t *>(buffer.Get());
 	ValidityMask mask(bitmask_ptr);
@@ -119,9 +118,20 @@ void FixedSizeAllocator::Reset() {
 	}
 	buffers.clear();
 	buffers_with_free_space.clear();
+	pinned_buffers.clear();
 	total_segment_count = 0;
 }
 
+void FixedSizeAllocator::Unpin() {
+	for (auto &buffer_id : pinned_buffers) {
+		auto entry = buffers.find(buffer_id);
+		if (entry != buffers.end()) {
+			entry->second.Unpin();
+		}
+	}
+	pinned_buffers.clear();
+}
+
 idx_t FixedSizeAllocator::GetInMemorySize() const {
 	idx_t memory_usage = 0;
 	for (auto &buffer : buffers) {
@@ -145,6 +155,7 @@ idx_t FixedSizeAllocator::GetUpperBoundBufferId() const {
 void FixedSizeAllocator::Merge(FixedSizeAllocator &other) {
 
 	D_ASSERT(segment_size == other.segment_size);
+	other.Unpin();
 
 	// remember the buffer count and merge the buffers
 	idx_t upper_bound_id = GetUpperBoundBufferId();
@@ -293,6 +304,9 @@ vector<IndexBufferInfo> FixedSizeAllocator::InitSerializationToWAL() {
 
 	vector<IndexBufferInfo> buffer_infos;
 	for (auto &buffer : buffers) {
+		if (!buffer.second.IsPinned()) {
+			pinned_buffers.push_back(buffer.first);
+		}
 		buffer.second.SetAllocationSize(available_segments_per_buffer, segment_size, bitmask_offset);
 		buffer_infos.emplace_back(buffer.second.Get(), buffer.second.allocation_size);
 	}
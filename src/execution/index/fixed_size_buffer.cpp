@@ -54,7 +54,7 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segmen
 }
 
 void FixedSizeBuffer::Destroy() {
-	if (InMemory()) {
+	if (IsPinned()) {
 		// we can have multiple readers on a pinned block, and unpinning the buffer handle
 		// decrements the reader count on the underlying block handle (Destroy() unpins)
 		buffer_handle.Destroy();
@@ -68,51 +68,51 @@ void FixedSizeBuffer::Destroy() {
 void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments,
                                 const idx_t segment_size, const idx_t bitmask_offset) {
 
-	// we do not serialize a block that is already on disk and not in memory
-	if (!InMemory()) {
-		if (!OnDisk() || dirty) {
+	// we do not serialize a block that is already on disk
+	if (OnDisk()) {
+		if (dirty) {
 			throw InternalException("invalid or missing buffer in FixedSizeAllocator");
 		}
-		return;
-	}
-
-	// we do not serialize a block that is already on disk and not dirty
-	if (!dirty && OnDisk()) {
+		Unpin();
 		return;
 	}
 
 	// the allocation possibly changed
 	SetAllocationSize(available_segments, segment_size, bitmask_offset);
 
-	// the buffer is in memory, so we copied it onto a new buffer when pinning
-	D_ASSERT(InMemory() && !OnDisk());
+	// the buffer is in memory, so we copied it onto a new buffer when loading it
+	D_ASSERT(InMemory());
+	if (!IsPinned()) {
+		Pin();
+	}
 
 	// now we write the changes, first get a partial block allocation
 	PartialBlockAllocation allocation =
 	    partial_block_manager.GetBlockAllocation(NumericCast<uint32_t>(allocation_size));
-	block_pointer.block_id = allocation.state.block_id;
-	block_pointer.offset = allocation.state.offset;
+	// the buffer is only on disk once its data is written, until then, it must be accessed in memory
+	BlockPointer new_block_pointer(allocation.state.block_id, allocation.state.offset);
 
 	auto &buffer_manager = block_manager.buffer_manager;
 
 	if (allocation.partial_block) {
 		// copy to an existing partial block
-		D_ASSERT(block_pointer.offset > 0);
+		D_ASSERT(new_block_pointer.offset > 0);
 		auto &p_block_for_index = allocation.partial_block->Cast<PartialBlockForIndex>();
 		auto dst_handle = buffer_manager.Pin(p_block_for_index.block_handle);
-		memcpy(dst_handle.Ptr() + block_pointer.offset, buffer_handle.Ptr(), allocation_size);
-		SetUninitializedRegions(p_block_for_index, segment_size, block_pointer.offset, bitmask_offset);
+		memcpy(dst_handle.Ptr() + new_block_pointer.offset, buffer_handle.Ptr(), allocation_size);
+		SetUninitializedRegions(p_block_for_index, segment_size, new_block_pointer.offset, bitmask_offset);
 
 	} else {
 		// create a new block that can potentially be used as a partial block
 		D_ASSERT(block_handle);
-		D_ASSERT(!block_pointer.offset);
+		D_ASSERT(!new_block_pointer.offset);
 		auto p_block_for_index = make_uniq<PartialBlockForIndex>(allocation.state, block_manager, block_handle);
-		SetUninitializedRegions(*p_block_for_index, segment_size, block_pointer.offset, bitmask_offset);
+		SetUninitializedRegions(*p_block_for_index, segment_size, new_block_pointer.offset, bitmask_offset);
 		allocation.partial_block = std::move(p_block_for_index);
 	}
 
 	partial_block_manager.RegisterPartialBlock(std::move(allocation));
+	block_pointer = new_block_pointer;
 
 	// resetting this buffer
 	buffer_handle.Destroy();
@@ -124,12 +124,25 @@ void FixedSizeBuffer::Serialize(PartialBlockManager &partial_block_manager, cons
 }
 
 void FixedSizeBuffer::Pin() {
+	D_ASSERT(block_handle && !IsPinned());
+	buffer_handle = block_manager.buffer_manager.Pin(block_handle);
+}
+
+void FixedSizeBuffer::Unpin() {
+	if (IsPinned()) {
+		buffer_handle.Destroy();
+	}
+}
+
+void FixedSizeBuffer::Load() {
 	auto &buffer_manager = block_manager.buffer_manager;
 	D_ASSERT(block_pointer.IsValid());
 	D_ASSERT(block_handle && block_handle->BlockId() < MAXIMUM_BLOCK);
 	D_ASSERT(!dirty);
 
-	buffer_handle = buffer_manager.Pin(block_handle);
+	if (!IsPinned()) {
+		Pin();
+	}
 
 	// we need to copy the (partial) data into a new (not yet disk-backed) buffer handle
 	shared_ptr<BlockHandle> new_block_handle;
@@ -227,8 +240,8 @@ uint32_t FixedSizeBuffer::GetMaxOffset(const idx_t available_segments) {
 
 		auto entry = data[i - 1];
 
-		// set all bits after bits_in_last_entry
-		if (i == bitmask_count) {
+		// set all bits after bits_in_last_entry, if the last entry is not used entirely
+		if (i == bitmask_count && bits_in_last_entry != 0) {
 			entry |= ~idx_t(0) << bits_in_last_entry;
 		}
 
@@ -0,0 +1,705 @@
+#include "duckdb/execution/index/hash_index.hpp"
+
+#include "duckdb/common/types/conflict_manager.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/index_storage_info.hpp"
+#include "duckdb/storage/partial_block_manager.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+//! A bucket segment holds the entries of a bucket chain. We store the full hash of each entry, so that we can split
+//! the chains without rehashing, and so that most mismatches are detected without comparing the keys.
+struct HashBucket {
+	//! The next bucket segment of the chain
+	IndexPointer next;
+	//! The number of entries in this bucket segment
+	idx_t count;
+	hash_t hashes[HashIndex::BUCKET_CAPACITY];
+	row_t row_ids[HashIndex::BUCKET_CAPACITY];
+	//! The keys, zero-padded to 16 bytes
+	uhugeint_t keys[HashIndex::BUCKET_CAPACITY];
+};
+
+//! The number of bucket chains of a directory segment
+static constexpr idx_t HASH_DIRECTORY_SEGMENT_CAPACITY = 252;
+
+//! A directory segment holds a part of the serialized directory
+struct HashDirectorySegment {
+	//! The next directory segment
+	IndexPointer next;
+	//! The number of bucket chains in this directory segment
+	idx_t count;
+	//! The number of entries in the index
+	idx_t entry_count;
+	IndexPointer chains[HASH_DIRECTORY_SEGMENT_CAPACITY];
+};
+
+//! We set the metadata of all segment pointers to distinguish them from empty pointers
+static IndexPointer NewSegment(FixedSizeAllocator &allocator) {
+	auto ptr = allocator.New();
+	ptr.SetMetadata(1);
+	return ptr;
+}
+
+//! Adds an entry to the first bucket segment of a chain, or to a new first segment, if the first segment is full
+static void AppendToChain(FixedSizeAllocator &allocator, IndexPointer &chain, const hash_t hash,
+                          const uhugeint_t &key, const row_t row_id) {
+	if (!chain.HasMetadata() || allocator.Get<HashBucket>(chain)->count == HashIndex::BUCKET_CAPACITY) {
+		auto ptr = NewSegment(allocator);
+		auto &new_bucket = *allocator.Get<HashBucket>(ptr);
+		new_bucket.next = chain;
+		new_bucket.count = 0;
+		chain = ptr;
+	}
+
+	auto &bucket = *allocator.Get<HashBucket>(chain);
+	bucket.hashes[bucket.count] = hash;
+	bucket.row_ids[bucket.count] = row_id;
+	bucket.keys[bucket.count] = key;
+	bucket.count++;
+}
+
+struct HashIndexScanState : public IndexScanState {
+	//! The constants of the point lookups
+	vector<Value> values;
+};
+
+//! Lookups only read the buckets, so they can pin on-disk buffers directly instead of loading them into memory.
+//! All buffers are unpinned once the lookup is done.
+class HashIndexReadOnlyScope {
+public:
+	explicit HashIndexReadOnlyScope(HashIndex &index) : index(index) {
+		index.bucket_allocator->SetReadOnly(true);
+	}
+	~HashIndexReadOnlyScope() {
+		index.bucket_allocator->SetReadOnly(false);
+		index.UnpinBuffers();
+	}
+
+private:
+	HashIndex &index;
+};
+
+//===--------------------------------------------------------------------===//
+// Hash Index
+//===--------------------------------------------------------------------===//
+
+HashIndex::HashIndex(const string &name, const IndexConstraintType index_constraint_type,
+                     const vector<column_t> &column_ids, TableIOManager &table_io_manager,
+                     const vector<unique_ptr<Expression>> &unbound_expressions, AttachedDatabase &db,
+                     const IndexStorageInfo &info)
+    : BoundIndex(name, HashIndex::TYPE_NAME, index_constraint_type, column_ids, table_io_manager,
+                 unbound_expressions, db) {
+
+	// validate the key
+	if (logical_types.size() != 1) {
+		throw NotImplementedException("Hash indexes can only be created on a single key column");
+	}
+	if (!TypeIsSupported(logical_types[0])) {
+		throw InvalidTypeException(logical_types[0], "Invalid type for hash index key.");
+	}
+
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	bucket_allocator = make_uniq<FixedSizeAllocator>(sizeof(HashBucket), block_manager);
+	directory_allocator = make_uniq<FixedSizeAllocator>(sizeof(HashDirectorySegment), block_manager);
+
+	if (info.IsValid()) {
+		D_ASSERT(info.allocator_infos.size() == ALLOCATOR_COUNT);
+		bucket_allocator->Init(info.allocator_infos[0]);
+		directory_allocator->Init(info.allocator_infos[1]);
+
+		IndexPointer root;
+		root.Set(info.root);
+		DeserializeDirectory(root);
+		if (info.hash_version != HASH_VERSION) {
+			// the stored hashes were computed by another version of the hash function
+			Rehash();
+		}
+	}
+
+	if (directory.empty()) {
+		directory.resize(INITIAL_DIRECTORY_SIZE);
+	}
+}
+
+bool HashIndex::TypeIsSupported(const LogicalType &type) {
+	// we compare the keys bytewise, which excludes floating-point keys (e.g., -0.0 = 0.0)
+	switch (type.InternalType()) {
+	case PhysicalType::BOOL:
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::INT128:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+	case PhysicalType::UINT128:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void HashIndex::GenerateKeys(Vector &input, idx_t count, vector<hash_t> &hashes, vector<uhugeint_t> &keys,
+                             vector<bool> &valid) const {
+
+	// hash all keys at once
+	Vector hash_vector(LogicalType::HASH, count);
+	VectorOperations::Hash(input, hash_vector, count);
+	hash_vector.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hash_vector);
+
+	UnifiedVectorFormat input_data;
+	input.ToUnifiedFormat(count, input_data);
+	auto type_size = GetTypeIdSize(types[0]);
+
+	hashes.resize(count);
+	keys.resize(count);
+	valid.resize(count);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = input_data.sel->get_index(i);
+		valid[i] = input_data.validity.RowIsValid(idx);
+		hashes[i] = hash_data[i];
+		memset(&keys[i], 0, sizeof(uhugeint_t));
+		memcpy(&keys[i], input_data.data + idx * type_size, type_size);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Lookups
+//===--------------------------------------------------------------------===//
+
+bool HashIndex::Lookup(const hash_t hash, const uhugeint_t &key, row_t &row_id) {
+	auto ptr = GetChain(hash);
+	while (ptr.HasMetadata()) {
+		auto &bucket = *bucket_allocator->Get<const HashBucket>(ptr, false);
+		for (idx_t i = 0; i < bucket.count; i++) {
+			if (bucket.hashes[i] == hash && bucket.keys[i] == key) {
+				row_id = bucket.row_ids[i];
+				return true;
+			}
+		}
+		ptr = bucket.next;
+	}
+	return false;
+}
+
+bool HashIndex::SearchEqual(const hash_t hash, const uhugeint_t &key, const idx_t max_count,
+                            vector<row_t> &row_ids) {
+	auto ptr = GetChain(hash);
+	while (ptr.HasMetadata()) {
+		auto &bucket = *bucket_allocator->Get<const HashBucket>(ptr, false);
+		for (idx_t i = 0; i < bucket.count; i++) {
+			if (bucket.hashes[i] == hash && bucket.keys[i] == key) {
+				if (row_ids.size() + 1 > max_count) {
+					return false;
+				}
+				row_ids.push_back(bucket.row_ids[i]);
+			}
+		}
+		ptr = bucket.next;
+	}
+	return true;
+}
+
+unique_ptr<IndexScanState> HashIndex::TryInitializeScan(const Transaction &transaction,
+                                                        const vector<unique_ptr<Expression>> &index_exprs,
+                                                        const vector<unique_ptr<Expression>> &filter_exprs) {
+
+	D_ASSERT(index_exprs.size() == 1);
+	for (auto &filter_expr : filter_exprs) {
+		vector<Value> constants;
+		if (!GetEqualityConstants(*index_exprs[0], *filter_expr, types[0], constants)) {
+			continue;
+		}
+		if (constants.size() > STANDARD_VECTOR_SIZE) {
+			// we probe the keys of a single vector
+			return nullptr;
+		}
+		auto result = make_uniq<HashIndexScanState>();
+		result->values = std::move(constants);
+		return std::move(result);
+	}
+	return nullptr;
+}
+
+bool HashIndex::Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state,
+                     const idx_t max_count, vector<row_t> &result_ids) {
+
+	auto &scan_state = state.Cast<HashIndexScanState>();
+	auto count = scan_state.values.size();
+	if (count == 0) {
+		return true;
+	}
+
+	Vector input(logical_types[0], count);
+	for (idx_t i = 0; i < count; i++) {
+		input.SetValue(i, scan_state.values[i]);
+	}
+	vector<hash_t> hashes;
+	vector<uhugeint_t> keys;
+	vector<bool> valid;
+	GenerateKeys(input, count, hashes, keys, valid);
+
+	vector<row_t> row_ids;
+	{
+		lock_guard<mutex> l(lock);
+		HashIndexReadOnlyScope read_only_scope(*this);
+		for (idx_t i = 0; i < count; i++) {
+			if (valid[i] && !SearchEqual(hashes[i], keys[i], max_count, row_ids)) {
+				return false;
+			}
+		}
+	}
+	if (row_ids.empty()) {
+		return true;
+	}
+
+	// sort the row ids, and duplicate eliminate them, e.g., for duplicate constants of an IN list
+	sort(row_ids.begin(), row_ids.end());
+	result_ids.reserve(row_ids.size());
+	result_ids.push_back(row_ids[0]);
+	for (idx_t i = 1; i < row_ids.size(); i++) {
+		if (row_ids[i] != row_ids[i - 1]) {
+			result_ids.push_back(row_ids[i]);
+		}
+	}
+	return true;
+}
+
+//===--------------------------------------------------------------------===//
+// Insert / Verification / Constraint Checking
+//===--------------------------------------------------------------------===//
+
+void HashIndex::InsertEntry(const hash_t hash, const uhugeint_t &key, const row_t row_id) {
+	// we double the directory once the bucket segments are (on average) three quarters full
+	if (entry_count >= directory.size() * BUCKET_CAPACITY * 3 / 4) {
+		Grow();
+	}
+	AppendToChain(*bucket_allocator, GetChain(hash), hash, key, row_id);
+	entry_count++;
+}
+
+void HashIndex::Grow() {
+
+	// the entries of chain i move to either chain i or chain i + old_size of the doubled directory
+	auto old_size = directory.size();
+	directory.resize(old_size * 2);
+
+	for (idx_t i = 0; i < old_size; i++) {
+		auto ptr = directory[i];
+		directory[i].Clear();
+
+		while (ptr.HasMetadata()) {
+			auto &bucket = *bucket_allocator->Get<HashBucket>(ptr);
+			for (idx_t j = 0; j < bucket.count; j++) {
+				auto &chain = GetChain(bucket.hashes[j]);
+				AppendToChain(*bucket_allocator, chain, bucket.hashes[j], bucket.keys[j], bucket.row_ids[j]);
+			}
+			auto next = bucket.next;
+			bucket_allocator->Free(ptr);
+			ptr = next;
+		}
+	}
+}
+
+void HashIndex::Rehash() {
+
+	// collect the keys and row IDs of all entries, and free their bucket segments
+	vector<uhugeint_t> old_keys;
+	vector<row_t> old_row_ids;
+	for (auto &chain : directory) {
+		auto ptr = chain;
+		chain.Clear();
+		while (ptr.HasMetadata()) {
+			auto &bucket = *bucket_allocator->Get<HashBucket>(ptr);
+			old_keys.insert(old_keys.end(), bucket.keys, bucket.keys + bucket.count);
+			old_row_ids.insert(old_row_ids.end(), bucket.row_ids, bucket.row_ids + bucket.count);
+			auto next = bucket.next;
+			bucket_allocator->Free(ptr);
+			ptr = next;
+		}
+	}
+
+	// re-insert the entries with their current hashes
+	entry_count = 0;
+	auto type_size = GetTypeIdSize(types[0]);
+	Vector input(logical_types[0]);
+	vector<hash_t> hashes;
+	vector<uhugeint_t> keys;
+	vector<bool> valid;
+	for (idx_t offset = 0; offset < old_keys.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(old_keys.size() - offset, STANDARD_VECTOR_SIZE);
+		auto input_data = FlatVector::GetData(input);
+		for (idx_t i = 0; i < count; i++) {
+			memcpy(input_data + i * type_size, &old_keys[offset + i], type_size);
+		}
+		GenerateKeys(input, count, hashes, keys, valid);
+		for (idx_t i = 0; i < count; i++) {
+			InsertEntry(hashes[i], keys[i], old_row_ids[offset + i]);
+		}
+	}
+}
+
+ErrorData HashIndex::Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) {
+
+	D_ASSERT(row_identifiers.GetType().InternalType() == ROW_TYPE);
+	D_ASSERT(logical_types[0] == input.data[0].GetType());
+
+	auto count = input.size();
+	vector<hash_t> hashes;
+	vector<uhugeint_t> keys;
+	vector<bool> valid;
+	GenerateKeys(input.data[0], count, hashes, keys, valid);
+
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(count, row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	// now insert the entries into the index
+	idx_t failed_index = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; i < count; i++) {
+		if (!valid[i]) {
+			continue;
+		}
+		row_t existing_row_id;
+		if (IsUnique() && Lookup(hashes[i], keys[i], existing_row_id)) {
+			failed_index = i;
+			break;
+		}
+		InsertEntry(hashes[i], keys[i], row_ids[row_id_data.sel->get_index(i)]);
+	}
+
+	// failed to insert because of constraint violation: remove previously inserted entries
+	if (failed_index != DConstants::INVALID_INDEX) {
+		for (idx_t i = 0; i < failed_index; i++) {
+			if (valid[i]) {
+				Erase(hashes[i], keys[i], row_ids[row_id_data.sel->get_index(i)]);
+			}
+		}
+		UnpinBuffers();
+		return ErrorData(ConstraintException("PRIMARY KEY or UNIQUE constraint violated: duplicate key \"%s\"",
+		                                     AppendRowError(input, failed_index)));
+	}
+
+	UnpinBuffers();
+	return ErrorData();
+}
+
+ErrorData HashIndex::Append(IndexLock &lock, DataChunk &appended_data, Vector &row_identifiers) {
+	DataChunk expression_result;
+	expression_result.Initialize(Allocator::DefaultAllocator(), logical_types);
+
+	// first resolve the expressions for the index
+	ExecuteExpressions(appended_data, expression_result);
+
+	// now insert into the index
+	return Insert(lock, expression_result, row_identifiers);
+}
+
+void HashIndex::VerifyAppend(DataChunk &chunk) {
+	ConflictManager conflict_manager(VerifyExistenceType::APPEND, chunk.size());
+	CheckConstraintsForChunk(chunk, conflict_manager);
+}
+
+void HashIndex::VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) {
+	D_ASSERT(conflict_manager.LookupType() == VerifyExistenceType::APPEND);
+	CheckConstraintsForChunk(chunk, conflict_manager);
+}
+
+void HashIndex::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) {
+
+	// don't alter the index during constraint checking
+	lock_guard<mutex> l(lock);
+	HashIndexReadOnlyScope read_only_scope(*this);
+
+	// first resolve the expressions for the index
+	DataChunk expression_chunk;
+	expression_chunk.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expression_chunk);
+
+	vector<hash_t> hashes;
+	vector<uhugeint_t> keys;
+	vector<bool> valid;
+	GenerateKeys(expression_chunk.data[0], expression_chunk.size(), hashes, keys, valid);
+
+	idx_t found_conflict = DConstants::INVALID_INDEX;
+	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
+
+		if (!valid[i]) {
+			if (conflict_manager.AddNull(i)) {
+				found_conflict = i;
+			}
+			continue;
+		}
+
+		row_t row_id;
+		if (!Lookup(hashes[i], keys[i], row_id)) {
+			if (conflict_manager.AddMiss(i)) {
+				found_conflict = i;
+			}
+			continue;
+		}
+
+		if (conflict_manager.AddHit(i, row_id)) {
+			found_conflict = i;
+		}
+	}
+
+	conflict_manager.FinishLookup();
+
+	if (found_conflict == DConstants::INVALID_INDEX) {
+		return;
+	}
+
+	auto key_name = GenerateErrorKeyName(input, found_conflict);
+	auto exception_msg = GenerateConstraintErrorMessage(conflict_manager.LookupType(), key_name);
+	throw ConstraintException(exception_msg);
+}
+
+string HashIndex::GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+                                                DataChunk &input) {
+	auto key_name = GenerateErrorKeyName(input, failed_index);
+	return GenerateConstraintErrorMessage(verify_type, key_name);
+}
+
+//===--------------------------------------------------------------------===//
+// Drop and Delete
+//===--------------------------------------------------------------------===//
+
+void HashIndex::CommitDrop(IndexLock &index_lock) {
+	bucket_allocator->Reset();
+	directory_allocator->Reset();
+	directory.clear();
+	directory.resize(INITIAL_DIRECTORY_SIZE);
+	entry_count = 0;
+}
+
+void HashIndex::Erase(const hash_t hash, const uhugeint_t &key, const row_t row_id) {
+
+	reference<IndexPointer> link(GetChain(hash));
+	while (link.get().HasMetadata()) {
+		auto &bucket = *bucket_allocator->Get<HashBucket>(link.get());
+		for (idx_t i = 0; i < bucket.count; i++) {
+			if (bucket.hashes[i] != hash || bucket.row_ids[i] != row_id || bucket.keys[i] != key) {
+				continue;
+			}
+
+			// move the last entry of the bucket segment into the gap, and free empty bucket segments
+			bucket.count--;
+			bucket.hashes[i] = bucket.hashes[bucket.count];
+			bucket.row_ids[i] = bucket.row_ids[bucket.count];
+			bucket.keys[i] = bucket.keys[bucket.count];
+			if (bucket.count == 0) {
+				auto ptr = link.get();
+				link.get() = bucket.next;
+				bucket_allocator->Free(ptr);
+			}
+			entry_count--;
+			return;
+		}
+		link = bucket.next;
+	}
+}
+
+void HashIndex::Delete(IndexLock &state, DataChunk &input, Vector &row_identifiers) {
+
+	DataChunk expression;
+	expression.Initialize(Allocator::DefaultAllocator(), logical_types);
+	ExecuteExpressions(input, expression);
+
+	vector<hash_t> hashes;
+	vector<uhugeint_t> keys;
+	vector<bool> valid;
+	GenerateKeys(expression.data[0], expression.size(), hashes, keys, valid);
+
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(input.size(), row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (valid[i]) {
+			Erase(hashes[i], keys[i], row_ids[row_id_data.sel->get_index(i)]);
+		}
+	}
+	UnpinBuffers();
+}
+
+//===--------------------------------------------------------------------===//
+// Merging / Vacuum
+//===--------------------------------------------------------------------===//
+
+bool HashIndex::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+
+	auto &other = other_index.Cast<HashIndex>();
+	auto success = true;
+	for (idx_t i = 0; success && i < other.directory.size(); i++) {
+		auto ptr = other.directory[i];
+		while (success && ptr.HasMetadata()) {
+			auto &bucket = *other.bucket_allocator->Get<const HashBucket>(ptr, false);
+			for (idx_t j = 0; j < bucket.count; j++) {
+				row_t existing_row_id;
+				if (IsUnique() && Lookup(bucket.hashes[j], bucket.keys[j], existing_row_id)) {
+					success = false;
+					break;
+				}
+				InsertEntry(bucket.hashes[j], bucket.keys[j], bucket.row_ids[j]);
+			}
+			ptr = bucket.next;
+		}
+	}
+
+	other.UnpinBuffers();
+	UnpinBuffers();
+	return success;
+}
+
+void HashIndex::Vacuum(IndexLock &state) {
+
+	if (!bucket_allocator->InitializeVacuum()) {
+		return;
+	}
+
+	// move the bucket segments of the vacuumed buffers, and update the pointers to them
+	for (auto &chain : directory) {
+		reference<IndexPointer> link(chain);
+		while (link.get().HasMetadata()) {
+			if (bucket_allocator->NeedsVacuum(link.get())) {
+				link.get() = bucket_allocator->VacuumPointer(link.get());
+				link.get().SetMetadata(1);
+			}
+			link = bucket_allocator->Get<HashBucket>(link.get())->next;
+		}
+	}
+
+	bucket_allocator->FinalizeVacuum();
+	UnpinBuffers();
+}
+
+//===--------------------------------------------------------------------===//
+// Serialization
+//===--------------------------------------------------------------------===//
+
+IndexPointer HashIndex::SerializeDirectory() {
+
+	// the directory segments of the previous serialization are outdated
+	directory_allocator->Reset();
+
+	IndexPointer root;
+	optional_ptr<HashDirectorySegment> previous;
+	for (idx_t i = 0; i < directory.size(); i += HASH_DIRECTORY_SEGMENT_CAPACITY) {
+		auto ptr = NewSegment(*directory_allocator);
+		auto &segment = *directory_allocator->Get<HashDirectorySegment>(ptr);
+		segment.next.Clear();
+		segment.count = MinValue(HASH_DIRECTORY_SEGMENT_CAPACITY, directory.size() - i);
+		segment.entry_count = entry_count;
+		for (idx_t j = 0; j < segment.count; j++) {
+			segment.chains[j] = directory[i + j];
+		}
+
+		if (previous) {
+			previous->next = ptr;
+		} else {
+			root = ptr;
+		}
+		previous = &segment;
+	}
+	return root;
+}
+
+void HashIndex::DeserializeDirectory(IndexPointer root) {
+
+	directory_allocator->SetReadOnly(true);
+	auto ptr = root;
+	while (ptr.HasMetadata()) {
+		auto &segment = *directory_allocator->Get<const HashDirectorySegment>(ptr, false);
+		directory.insert(directory.end(), segment.chains, segment.chains + segment.count);
+		entry_count = segment.entry_count;
+		ptr = segment.next;
+	}
+	directory_allocator->SetReadOnly(false);
+	directory_allocator->Unpin();
+	D_ASSERT(directory.empty() || IsPowerOfTwo(directory.size()));
+}
+
+IndexStorageInfo HashIndex::GetStorageInfo(const bool get_buffers) {
+
+	lock_guard<mutex> l(lock);
+
+	IndexStorageInfo info;
+	info.name = name;
+	info.root = SerializeDirectory().Get();
+	info.hash_version = HASH_VERSION;
+
+	if (!get_buffers) {
+		// store the data on disk as partial blocks and set the block ids
+		WritePartialBlocks();
+		UnpinBuffers();
+
+	} else {
+		// set the correct allocation sizes and get the map containing all buffers
+		info.buffers.push_back(bucket_allocator->InitSerializationToWAL());
+		info.buffers.push_back(directory_allocator->InitSerializationToWAL());
+	}
+
+	info.allocator_infos.push_back(bucket_allocator->GetInfo());
+	info.allocator_infos.push_back(directory_allocator->GetInfo());
+	return info;
+}
+
+void HashIndex::WritePartialBlocks() {
+
+	// use the partial block manager to serialize all allocator data
+	auto &block_manager = table_io_manager.GetIndexBlockManager();
+	PartialBlockManager partial_block_manager(block_manager, PartialBlockType::FULL_CHECKPOINT);
+
+	bucket_allocator->SerializeBuffers(partial_block_manager);
+	directory_allocator->SerializeBuffers(partial_block_manager);
+	partial_block_manager.FlushPartialBlocks();
+}
+
+//===--------------------------------------------------------------------===//
+// Utility
+//===--------------------------------------------------------------------===//
+
+idx_t HashIndex::GetInMemorySize(IndexLock &index_lock) {
+	return bucket_allocator->GetInMemorySize() + directory_allocator->GetInMemorySize() +
+	       directory.size() * sizeof(IndexPointer);
+}
+
+void HashIndex::UnpinBuffers() {
+	bucket_allocator->Unpin();
+	directory_allocator->Unpin();
+}
+
+string HashIndex::VerifyAndToString(IndexLock &state, const bool only_verify) {
+
+	idx_t count = 0;
+	for (auto &chain : directory) {
+		auto ptr = chain;
+		while (ptr.HasMetadata()) {
+			auto &bucket = *bucket_allocator->Get<const HashBucket>(ptr, false);
+			D_ASSERT(bucket.count > 0 && bucket.count <= BUCKET_CAPACITY);
+			count += bucket.count;
+			ptr = bucket.next;
+		}
+	}
+	UnpinBuffers();
+
+	if (count != entry_count) {
+		throw InternalException("Hash index contains %llu entries, expected %llu", count, entry_count);
+	}
+	return only_verify ? string()
+	                   : "Hash index: " + to_string(count) + " entries in " + to_string(directory.size()) + " chains";
+}
+
+constexpr const char *HashIndex::TYPE_NAME;
+constexpr uint8_t HashIndex::BUCKET_CAPACITY;
+constexpr idx_t HashIndex::INITIAL_DIRECTORY_SIZE;
+constexpr uint8_t HashIndex::ALLOCATOR_COUNT;
+
+} // namespace duckdb
@@ -1,6 +1,8 @@
 #include "duckdb/execution/index/index_type.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/execution/index/hash_index.hpp"
 
 namespace duckdb {
 
@@ -10,6 +12,18 @@ IndexTypeSet::IndexTypeSet() {
 	art_index_type.name = ART::TYPE_NAME;
 	art_index_type.create_instance = ART::Create;
 	RegisterIndexType(art_index_type);
+
+	// Register the Bloom filter index type
+	IndexType bloom_index_type;
+	bloom_index_type.name = BloomIndex::TYPE_NAME;
+	bloom_index_type.create_instance = BloomIndex::Create;
+	RegisterIndexType(bloom_index_type);
+
+	// Register the hash index type
+	IndexType hash_index_type;
+	hash_index_type.name = HashIndex::TYPE_NAME;
+	hash_index_type.create_instance = HashIndex::Create;
+	RegisterIndexType(hash_index_type);
 }
 
 optional_ptr<IndexType> IndexTypeSet::FindByName(const string &name) {
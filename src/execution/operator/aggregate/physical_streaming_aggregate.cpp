@@ -0,0 +1,365 @@
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
+
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+namespace duckdb {
+
+PhysicalStreamingAggregate::PhysicalStreamingAggregate(vector<LogicalType> types_p,
+                                                       vector<unique_ptr<Expression>> aggregates_p,
+                                                       vector<unique_ptr<Expression>> groups_p,
+                                                       idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::STREAMING_GROUP_BY, std::move(types_p), estimated_cardinality),
+      groups(std::move(groups_p)), aggregates(std::move(aggregates_p)) {
+#ifdef DEBUG
+	for (auto &group : groups) {
+		D_ASSERT(group->type == ExpressionType::BOUND_REF);
+	}
+#endif
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class StreamingAggregateState : public OperatorState {
+public:
+	StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op);
+	~StreamingAggregateState() override;
+
+	//! A group within the current chunk: the slot that holds its aggregate states, and the row on which it starts
+	struct ChunkGroup {
+		idx_t slot;
+		optional_idx start_row;
+	};
+
+public:
+	//! Get the aggregate states of a slot
+	data_ptr_t GetSlot(idx_t slot) {
+		return state_data.get() + slot * state_width;
+	}
+	//! Initialize the aggregate states of a slot
+	void InitializeSlot(idx_t slot);
+	//! Whether the group of the first row in the chunk is the open group
+	bool ContinuesOpenGroup(DataChunk &input);
+	//! Update the aggregate states of the rows [row_from, row_to) of the input, allocating from the given allocator
+	void UpdateStates(DataChunk &input, idx_t row_from, idx_t row_to, ArenaAllocator &arena);
+	//! Finalize (and destroy) the aggregate states of the given groups into the result
+	void FinalizeGroups(const vector<ChunkGroup> &chunk_groups, idx_t count, DataChunk &result);
+
+public:
+	const PhysicalStreamingAggregate &op;
+	//! The allocator for the aggregate states of the groups that are completed within the current chunk
+	ArenaAllocator allocator;
+	//! The allocators for the aggregate states of the open group, and of the group that is opened next. All allocators
+	//! except the one of the open group are reset once their groups are emitted, so the memory does not grow with the
+	//! input
+	unique_ptr<ArenaAllocator> open_allocator;
+	unique_ptr<ArenaAllocator> next_open_allocator;
+	//! The offset of each aggregate in a slot, and the total width of a slot
+	vector<idx_t> state_offsets;
+	idx_t state_width;
+	//! The slots, one for each group in a chunk, plus one for the group that is still open
+	unsafe_unique_array<data_t> state_data;
+
+	//! Whether there is a group that is still open, i.e., that may continue in the next chunk, its slot and its key
+	bool has_open_group;
+	idx_t open_slot;
+	vector<Value> open_key;
+
+	//! Which rows start a new group
+	unsafe_unique_array<bool> new_group;
+	//! Selection vectors for finding the group boundaries
+	SelectionVector next_sel;
+	SelectionVector change_sel;
+	SelectionVector filter_sel;
+	SelectionVector key_sel;
+	//! The groups in the current chunk
+	vector<ChunkGroup> chunk_groups;
+	//! Pointers to the slot of each row, to the states of an aggregate, and the states to finalize
+	Vector row_slots;
+	Vector addresses;
+	Vector finalize_addresses;
+};
+
+StreamingAggregateState::StreamingAggregateState(ClientContext &context, const PhysicalStreamingAggregate &op_p)
+    : op(op_p), allocator(BufferAllocator::Get(context)),
+      open_allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context))),
+      next_open_allocator(make_uniq<ArenaAllocator>(BufferAllocator::Get(context))), state_width(0),
+      has_open_group(false), open_slot(0),
+      next_sel(STANDARD_VECTOR_SIZE), change_sel(STANDARD_VECTOR_SIZE), filter_sel(STANDARD_VECTOR_SIZE),
+      key_sel(STANDARD_VECTOR_SIZE), row_slots(LogicalType::POINTER), addresses(LogicalType::POINTER),
+      finalize_addresses(LogicalType::POINTER) {
+	for (auto &aggregate : op.aggregates) {
+		auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+		state_offsets.push_back(state_width);
+		state_width += AlignValue(aggr.function.state_size());
+	}
+	state_width = MaxValue<idx_t>(state_width, 1);
+	state_data = make_unsafe_uniq_array<data_t>((STANDARD_VECTOR_SIZE + 1) * state_width);
+	new_group = make_unsafe_uniq_array<bool>(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i + 1 < STANDARD_VECTOR_SIZE; i++) {
+		next_sel.set_index(i, i + 1);
+	}
+}
+
+StreamingAggregateState::~StreamingAggregateState() {
+	if (!has_open_group) {
+		return;
+	}
+	// the open group was never finalized (e.g., because of a LIMIT): destroy its states
+	Vector state_vector(LogicalType::POINTER);
+	auto states = FlatVector::GetData<data_ptr_t>(state_vector);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		if (!aggr.function.destructor) {
+			continue;
+		}
+		states[0] = GetSlot(open_slot) + state_offsets[aggr_idx];
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), *open_allocator);
+		aggr.function.destructor(state_vector, aggr_input_data, 1);
+	}
+}
+
+void StreamingAggregateState::InitializeSlot(idx_t slot) {
+	auto slot_data = GetSlot(slot);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		aggr.function.initialize(slot_data + state_offsets[aggr_idx]);
+	}
+}
+
+bool StreamingAggregateState::ContinuesOpenGroup(DataChunk &input) {
+	if (!has_open_group) {
+		return false;
+	}
+	for (idx_t group_idx = 0; group_idx < op.groups.size(); group_idx++) {
+		auto &group = op.groups[group_idx]->Cast<BoundReferenceExpression>();
+		if (!Value::NotDistinctFrom(input.GetValue(group.index, 0), open_key[group_idx])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void StreamingAggregateState::FinalizeGroups(const vector<ChunkGroup> &groups_to_finalize, idx_t count,
+                                             DataChunk &result) {
+	auto states = FlatVector::GetData<data_ptr_t>(finalize_addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+		for (idx_t i = 0; i < count; i++) {
+			states[i] = GetSlot(groups_to_finalize[i].slot) + state_offsets[aggr_idx];
+		}
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), allocator);
+		auto &target = result.data[op.groups.size() + aggr_idx];
+		aggr.function.finalize(finalize_addresses, aggr_input_data, target, count, 0);
+		if (aggr.function.destructor) {
+			aggr.function.destructor(finalize_addresses, aggr_input_data, count);
+		}
+	}
+}
+
+void StreamingAggregateState::UpdateStates(DataChunk &input, idx_t row_from, idx_t row_to, ArenaAllocator &arena) {
+	if (row_from == row_to) {
+		return;
+	}
+	const auto all_rows = row_from == 0 && row_to == input.size();
+	auto row_slot_data = FlatVector::GetData<data_ptr_t>(row_slots);
+	auto address_data = FlatVector::GetData<data_ptr_t>(addresses);
+	for (idx_t aggr_idx = 0; aggr_idx < op.aggregates.size(); aggr_idx++) {
+		auto &aggr = op.aggregates[aggr_idx]->Cast<BoundAggregateExpression>();
+
+		// select the rows to update if we do not update all of them
+		const auto use_sel = aggr.filter || !all_rows;
+		idx_t update_count = 0;
+		if (aggr.filter) {
+			auto &filter_column = input.data[aggr.filter->Cast<BoundReferenceExpression>().index];
+			UnifiedVectorFormat filter_data;
+			filter_column.ToUnifiedFormat(input.size(), filter_data);
+			auto filter_values = UnifiedVectorFormat::GetData<bool>(filter_data);
+			for (idx_t row_idx = row_from; row_idx < row_to; row_idx++) {
+				auto filter_idx = filter_data.sel->get_index(row_idx);
+				if (filter_data.validity.RowIsValid(filter_idx) && filter_values[filter_idx]) {
+					filter_sel.set_index(update_count++, row_idx);
+				}
+			}
+			if (update_count == 0) {
+				continue;
+			}
+		} else if (use_sel) {
+			for (idx_t row_idx = row_from; row_idx < row_to; row_idx++) {
+				filter_sel.set_index(update_count++, row_idx);
+			}
+		} else {
+			update_count = input.size();
+		}
+
+		vector<Vector> inputs;
+		inputs.reserve(aggr.children.size());
+		for (auto &child : aggr.children) {
+			auto &child_column = input.data[child->Cast<BoundReferenceExpression>().index];
+			if (use_sel) {
+				inputs.emplace_back(child_column, filter_sel, update_count);
+			} else {
+				inputs.emplace_back(child_column);
+			}
+		}
+		// the addresses are flat and aligned with the (selected) inputs: some aggregates, e.g., the sorted aggregates,
+		// use the index of a state in the address vector as the index of its row in the inputs
+		for (idx_t i = 0; i < update_count; i++) {
+			auto row_idx = use_sel ? filter_sel.get_index(i) : i;
+			address_data[i] = row_slot_data[row_idx] + state_offsets[aggr_idx];
+		}
+		AggregateInputData aggr_input_data(aggr.bind_info.get(), arena);
+		auto input_data = inputs.empty() ? nullptr : inputs.data();
+		aggr.function.update(input_data, aggr_input_data, inputs.size(), addresses, update_count);
+	}
+}
+
+unique_ptr<OperatorState> PhysicalStreamingAggregate::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<StreamingAggregateState>(context.client, *this);
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+OperatorResultType PhysicalStreamingAggregate::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                                       GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	const auto count = input.size();
+	if (count == 0) {
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// find the rows that start a new group: the rows where any of the groups differs from the previous row
+	auto new_group = state.new_group.get();
+	new_group[0] = !state.ContinuesOpenGroup(input);
+	std::fill_n(new_group + 1, count - 1, false);
+	if (count > 1) {
+		for (auto &group_expr : groups) {
+			auto &group_column = input.data[group_expr->Cast<BoundReferenceExpression>().index];
+			Vector previous(group_column, *FlatVector::IncrementalSelectionVector(), count - 1);
+			Vector next(group_column, state.next_sel, count - 1);
+			auto changed_count =
+			    VectorOperations::DistinctFrom(next, previous, nullptr, count - 1, &state.change_sel, nullptr);
+			for (idx_t i = 0; i < changed_count; i++) {
+				new_group[state.change_sel.get_index(i) + 1] = true;
+			}
+		}
+	}
+
+	// assign a slot to every group in this chunk, starting with the open group (even if it has no rows here)
+	auto &chunk_groups = state.chunk_groups;
+	chunk_groups.clear();
+	if (state.has_open_group) {
+		chunk_groups.push_back({state.open_slot, optional_idx()});
+	}
+	idx_t next_slot = 0;
+	auto row_slots = FlatVector::GetData<data_ptr_t>(state.row_slots);
+	for (idx_t row_idx = 0; row_idx < count; row_idx++) {
+		if (new_group[row_idx]) {
+			if (state.has_open_group && next_slot == state.open_slot) {
+				next_slot++;
+			}
+			state.InitializeSlot(next_slot);
+			chunk_groups.push_back({next_slot++, row_idx});
+		}
+		row_slots[row_idx] = state.GetSlot(chunk_groups.back().slot);
+	}
+
+	// update the aggregate states. The last group stays open if it starts in this chunk: its states are allocated
+	// separately, so that the memory of all other groups can be released once they are emitted
+	auto &last_group = chunk_groups.back();
+	if (last_group.start_row.IsValid()) {
+		const auto last_row = last_group.start_row.GetIndex();
+		state.UpdateStates(input, 0, last_row, state.allocator);
+		state.UpdateStates(input, last_row, count, *state.next_open_allocator);
+	} else {
+		state.UpdateStates(input, 0, count, *state.open_allocator);
+	}
+
+	// every group except the last one is complete: emit them
+	const auto finished_count = chunk_groups.size() - 1;
+	if (finished_count > 0) {
+		idx_t key_count = 0;
+		idx_t output_offset = 0;
+		for (idx_t i = 0; i < finished_count; i++) {
+			if (!chunk_groups[i].start_row.IsValid()) {
+				// the group was opened in a previous chunk
+				D_ASSERT(i == 0);
+				for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+					chunk.data[group_idx].SetValue(0, state.open_key[group_idx]);
+				}
+				output_offset = 1;
+				continue;
+			}
+			state.key_sel.set_index(key_count++, chunk_groups[i].start_row.GetIndex());
+		}
+		for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+			auto &group_column = input.data[groups[group_idx]->Cast<BoundReferenceExpression>().index];
+			VectorOperations::Copy(group_column, chunk.data[group_idx], state.key_sel, key_count, 0, output_offset);
+		}
+		state.FinalizeGroups(chunk_groups, finished_count, chunk);
+		chunk.SetCardinality(finished_count);
+	}
+
+	// the last group stays open
+	if (last_group.start_row.IsValid()) {
+		state.open_key.clear();
+		for (auto &group_expr : groups) {
+			auto &group = group_expr->Cast<BoundReferenceExpression>();
+			state.open_key.push_back(input.GetValue(group.index, last_group.start_row.GetIndex()));
+		}
+		// the previously open group has been emitted
+		state.allocator.Reset();
+		state.open_allocator->Reset();
+		std::swap(state.open_allocator, state.next_open_allocator);
+	}
+	state.open_slot = last_group.slot;
+	state.has_open_group = true;
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+OperatorFinalizeResultType PhysicalStreamingAggregate::FinalExecute(ExecutionContext &context, DataChunk &chunk,
+                                                                    GlobalOperatorState &gstate,
+                                                                    OperatorState &state_p) const {
+	auto &state = state_p.Cast<StreamingAggregateState>();
+	if (!state.has_open_group) {
+		return OperatorFinalizeResultType::FINISHED;
+	}
+	// emit the last group
+	for (idx_t group_idx = 0; group_idx < groups.size(); group_idx++) {
+		chunk.data[group_idx].SetValue(0, state.open_key[group_idx]);
+	}
+	state.chunk_groups.clear();
+	state.chunk_groups.push_back({state.open_slot, optional_idx()});
+	state.FinalizeGroups(state.chunk_groups, 1, chunk);
+	chunk.SetCardinality(1);
+	state.has_open_group = false;
+	return OperatorFinalizeResultType::FINISHED;
+}
+
+string PhysicalStreamingAggregate::ParamsToString() const {
+	string result;
+	for (idx_t i = 0; i < groups.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		result += groups[i]->GetName();
+	}
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		if (i > 0 || !groups.empty()) {
+			result += "\n";
+		}
+		result += aggregates[i]->GetName();
+		auto &aggregate = aggregates[i]->Cast<BoundAggregateExpression>();
+		if (aggregate.filter) {
+			result += " Filter: " + aggregate.filter->GetName();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
@@ -107,6 +107,12 @@ public:
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Create a thread-local collection for materializing the probe side of a deferred probe
+	void RegisterDeferredProbe(const vector<LogicalType> &types, optional_ptr<ColumnDataCollection> &collection,
+	                           optional_ptr<ColumnDataAppendState> &append_state);
+
+	//! The minimum size of the build side before we consider deferring the probe
+	static constexpr const idx_t DEFERRED_PROBE_MINIMUM_BUILD_COUNT = 131072;
 
 public:
 	ClientContext &context;
@@ -136,6 +142,13 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! Whether the probe is deferred to the source phase, because the build side turned out to be much larger than
+	//! estimated. Once the actual size of the probe side is known, the build and probe side may be flipped
+	bool deferred_probe = false;
+	//! Thread-local collections that hold the materialized probe side of a deferred probe
+	vector<unique_ptr<ColumnDataCollection>> deferred_probe_collections;
+	vector<unique_ptr<ColumnDataAppendState>> deferred_probe_append_states;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -370,6 +383,19 @@ void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	}
 }
 
+void HashJoinGlobalSinkState::RegisterDeferredProbe(const vector<LogicalType> &types,
+                                                    optional_ptr<ColumnDataCollection> &collection,
+                                                    optional_ptr<ColumnDataAppendState> &append_state) {
+	lock_guard<mutex> guard(lock);
+	deferred_probe_collections.push_back(
+	    make_uniq<ColumnDataCollection>(BufferManager::GetBufferManager(context), types));
+	deferred_probe_append_states.push_back(make_uniq<ColumnDataAppendState>());
+	deferred_probe_collections.back()->InitializeAppend(*deferred_probe_append_states.back());
+
+	collection = deferred_probe_collections.back().get();
+	append_state = deferred_probe_append_states.back().get();
+}
+
 class HashJoinRepartitionTask : public ExecutorTask {
 public:
 	HashJoinRepartitionTask(shared_ptr<Event> event_p, ClientContext &context, JoinHashTable &global_ht,
@@ -455,6 +481,28 @@ public:
 	}
 };
 
+//! Whether the probe should be deferred until the actual size of the probe side is known. This is the case if the build
+//! side diverged so much from its estimate that it is now expected to be much larger than the probe side
+static bool ShouldDeferProbe(const PhysicalHashJoin &op, ClientContext &context, idx_t build_count) {
+	auto threshold = ClientConfig::GetConfig(context).adaptive_join_threshold;
+	if (threshold == 0 || build_count < HashJoinGlobalSinkState::DEFERRED_PROBE_MINIMUM_BUILD_COUNT) {
+		return false;
+	}
+	// we can only flip inner joins with equality conditions
+	if (op.join_type != JoinType::INNER || !op.delim_types.empty()) {
+		return false;
+	}
+	for (auto &condition : op.conditions) {
+		if (condition.comparison != ExpressionType::COMPARE_EQUAL &&
+		    condition.comparison != ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+			return false;
+		}
+	}
+	auto build_estimate = MaxValue<idx_t>(op.children[1]->estimated_cardinality, 1);
+	auto probe_estimate = MaxValue<idx_t>(op.children[0]->estimated_cardinality, 1);
+	return build_count / threshold >= build_estimate && build_count / threshold >= probe_estimate;
+}
+
 SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                             OperatorSinkFinalizeInput &input) const {
 	auto &sink = input.global_state.Cast<HashJoinGlobalSinkState>();
@@ -497,6 +545,14 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		ht.Unpartition();
 	}
 
+	if (ShouldDeferProbe(*this, context, ht.Count())) {
+		// the build side is much larger than estimated: materialize the probe side before building the pointer table
+		sink.perfect_join_executor.reset();
+		sink.deferred_probe = true;
+		sink.finalized = true;
+		return SinkFinalizeType::READY;
+	}
+
 	// check for possible perfect hash table
 	auto use_perfect_hash = sink.perfect_join_executor->CanDoPerfectHashJoin();
 	if (use_perfect_hash) {
@@ -537,6 +593,10 @@ public:
 	//! Chunk to sink data into for external join
 	DataChunk spill_chunk;
 
+	//! Thread-local collection to materialize the probe side into (if the probe is deferred)
+	optional_ptr<ColumnDataCollection> deferred_probe_collection;
+	optional_ptr<ColumnDataAppendState> deferred_probe_append_state;
+
 public:
 	void Finalize(const PhysicalOperator &op, ExecutionContext &context) override {
 		context.thread.profiler.Flush(op, probe_executor, "probe_executor", 0);
@@ -580,6 +640,16 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 		state.initialized = true;
 	}
 
+	if (sink.deferred_probe) {
+		// materialize the probe side, the actual probe happens in GetData
+		if (!state.deferred_probe_collection) {
+			sink.RegisterDeferredProbe(children[0]->types, state.deferred_probe_collection,
+			                           state.deferred_probe_append_state);
+		}
+		state.deferred_probe_collection->Append(*state.deferred_probe_append_state, input);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
 	if (sink.hash_table->Count() == 0 && EmptyResultIfRHSIsEmpty()) {
 		return OperatorResultType::FINISHED;
 	}
@@ -624,7 +694,7 @@ OperatorResultType PhysicalHashJoin::ExecuteInternal(ExecutionContext &context,
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
-enum class HashJoinSourceStage : uint8_t { INIT, BUILD, PROBE, SCAN_HT, DONE };
+enum class HashJoinSourceStage : uint8_t { INIT, BUILD, PROBE, SCAN_HT, SINK_FLIPPED, PROBE_DEFERRED, DONE };
 
 class HashJoinLocalSourceState;
 
@@ -642,6 +712,12 @@ public:
 	void PrepareScanHT(HashJoinGlobalSinkState &sink);
 	//! Assigns a task to a local source state
 	bool AssignTask(HashJoinGlobalSinkState &sink, HashJoinLocalSourceState &lstate);
+	//! Decide whether to flip the build and probe side of a deferred probe, and prepare building the hash table
+	void InitializeDeferredProbe(ClientContext &context, HashJoinGlobalSinkState &sink);
+	//! Prepare the next stages of a deferred probe (must hold lock)
+	void PrepareDeferredBuild(HashJoinGlobalSinkState &sink, JoinHashTable &ht);
+	void PrepareFlippedBuild(HashJoinGlobalSinkState &sink);
+	void PrepareDeferredProbe(HashJoinGlobalSinkState &sink);
 
 	idx_t MaxThreads() override {
 		D_ASSERT(op.sink_state);
@@ -650,6 +726,8 @@ public:
 		idx_t count;
 		if (gstate.probe_spill) {
 			count = probe_count;
+		} else if (gstate.deferred_probe) {
+			count = gstate.hash_table->Count();
 		} else if (PropagatesBuildSide(op.join_type)) {
 			count = gstate.hash_table->Count();
 		} else {
@@ -686,6 +764,29 @@ public:
 	idx_t full_outer_chunks_per_thread;
 
 	vector<InterruptState> blocked_tasks;
+
+	//! For deferred probes
+	bool deferred_probe_finished = false;
+	//! Whether the build and probe side were flipped, i.e., the materialized probe side was used to build a hash table
+	//! which is probed with the rows of the original build side
+	bool flipped = false;
+	//! The materialized probe side
+	unique_ptr<ColumnDataCollection> deferred_probe_collection;
+	ColumnDataParallelScanState deferred_probe_scan_state;
+	//! The conditions and output columns of the flipped hash table (must outlive it)
+	vector<JoinCondition> flipped_conditions;
+	vector<idx_t> flipped_output_columns;
+	//! The hash table built on the probe side
+	unique_ptr<JoinHashTable> flipped_hash_table;
+	//! The hash tables that the threads inserted their chunks of the materialized probe side into
+	vector<unique_ptr<JoinHashTable>> flipped_local_hash_tables;
+	//! For synchronizing the insertion of the materialized probe side into the flipped hash table
+	idx_t flip_chunk_idx = 0;
+	idx_t flip_chunk_count = 0;
+	idx_t flip_chunk_done = 0;
+	idx_t flip_chunks_per_thread = 0;
+	//! Scan state over the rows of the original build side
+	TupleDataParallelScanState build_scan_state;
 };
 
 class HashJoinLocalSourceState : public LocalSourceState {
@@ -700,6 +801,11 @@ public:
 	void ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
 	void ExternalProbe(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
 	void ExternalScanHT(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate, DataChunk &chunk);
+	//! Insert the assigned chunks of the materialized probe side into a hash table, for a flipped deferred probe
+	void SinkFlipped(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate);
+	//! Probe for a deferred probe (possibly with the build and probe side flipped)
+	void DeferredProbe(ExecutionContext &context, HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
+	                   DataChunk &chunk);
 
 public:
 	//! The stage that this thread was assigned work for
@@ -731,6 +837,19 @@ public:
 	idx_t full_outer_chunk_idx_from;
 	idx_t full_outer_chunk_idx_to;
 	unique_ptr<JoinHTScanState> full_outer_scan_state;
+
+	//! Chunks of the materialized probe side assigned to this thread for building the flipped hash table
+	idx_t flip_chunk_idx_from;
+	idx_t flip_chunk_idx_to;
+	DataChunk flip_chunk;
+
+	//! For deferred probes: the chunk that is probed with, and the result of probing the flipped hash table
+	bool deferred_probe_initialized;
+	DataChunk deferred_chunk;
+	DataChunk flipped_result;
+	unique_ptr<ExpressionExecutor> deferred_key_executor;
+	ColumnDataLocalScanState deferred_probe_local_scan;
+	TupleDataLocalScanState build_local_scan;
 };
 
 unique_ptr<GlobalSourceState> PhysicalHashJoin::GetGlobalSourceState(ClientContext &context) const {
@@ -768,6 +887,10 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 	switch (global_stage.load()) {
 	case HashJoinSourceStage::BUILD:
 		if (build_chunk_done == build_chunk_count) {
+			if (sink.deferred_probe) {
+				PrepareDeferredProbe(sink);
+				return true;
+			}
 			sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 			sink.hash_table->finalized = true;
 			PrepareProbe(sink);
@@ -790,6 +913,12 @@ bool HashJoinGlobalSourceState::TryPrepareNextStage(HashJoinGlobalSinkState &sin
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::SINK_FLIPPED:
+		if (flip_chunk_done == flip_chunk_count) {
+			PrepareFlippedBuild(sink);
+			return true;
+		}
+		break;
 	default:
 		break;
 	}
@@ -888,6 +1017,16 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 			return true;
 		}
 		break;
+	case HashJoinSourceStage::SINK_FLIPPED:
+		if (flip_chunk_idx != flip_chunk_count) {
+			lstate.local_stage = global_stage;
+			lstate.flip_chunk_idx_from = flip_chunk_idx;
+			flip_chunk_idx = MinValue<idx_t>(flip_chunk_count, flip_chunk_idx + flip_chunks_per_thread);
+			lstate.flip_chunk_idx_to = flip_chunk_idx;
+			return true;
+		}
+		break;
+	case HashJoinSourceStage::PROBE_DEFERRED:
 	case HashJoinSourceStage::DONE:
 		break;
 	default:
@@ -897,7 +1036,7 @@ bool HashJoinGlobalSourceState::AssignTask(HashJoinGlobalSinkState &sink, HashJo
 }
 
 HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, Allocator &allocator)
-    : local_stage(HashJoinSourceStage::INIT), addresses(LogicalType::POINTER) {
+    : local_stage(HashJoinSourceStage::INIT), addresses(LogicalType::POINTER), deferred_probe_initialized(false) {
 	auto &chunk_state = probe_local_scan.current_chunk_state;
 	chunk_state.properties = ColumnDataScanProperties::ALLOW_ZERO_COPY;
 
@@ -915,6 +1054,15 @@ HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, A
 	for (; col_idx < sink.probe_types.size() - 1; col_idx++) {
 		payload_indices.push_back(col_idx);
 	}
+
+	if (sink.deferred_probe) {
+		// the keys of the materialized probe side are computed both when flipping and when probing
+		flip_chunk.Initialize(allocator, op.children[0]->types);
+		deferred_key_executor = make_uniq<ExpressionExecutor>(sink.context);
+		for (auto &condition : op.conditions) {
+			deferred_key_executor->AddExpression(*condition.left);
+		}
+	}
 }
 
 void HashJoinLocalSourceState::ExecuteTask(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate,
@@ -929,6 +1077,9 @@ void HashJoinLocalSourceState::ExecuteTask(HashJoinGlobalSinkState &sink, HashJo
 	case HashJoinSourceStage::SCAN_HT:
 		ExternalScanHT(sink, gstate, chunk);
 		break;
+	case HashJoinSourceStage::SINK_FLIPPED:
+		SinkFlipped(sink, gstate);
+		break;
 	default:
 		throw InternalException("Unexpected HashJoinSourceStage in ExecuteTask!");
 	}
@@ -938,6 +1089,7 @@ bool HashJoinLocalSourceState::TaskFinished() {
 	switch (local_stage) {
 	case HashJoinSourceStage::INIT:
 	case HashJoinSourceStage::BUILD:
+	case HashJoinSourceStage::SINK_FLIPPED:
 		return true;
 	case HashJoinSourceStage::PROBE:
 		return scan_structure == nullptr && !empty_ht_probe_in_progress;
@@ -951,7 +1103,8 @@ bool HashJoinLocalSourceState::TaskFinished() {
 void HashJoinLocalSourceState::ExternalBuild(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate) {
 	D_ASSERT(local_stage == HashJoinSourceStage::BUILD);
 
-	auto &ht = *sink.hash_table;
+	// a flipped deferred probe builds the hash table on the probe side instead
+	auto &ht = gstate.flipped_hash_table ? *gstate.flipped_hash_table : *sink.hash_table;
 	ht.Finalize(build_chunk_idx_from, build_chunk_idx_to, true);
 
 	lock_guard<mutex> guard(gstate.lock);
@@ -1016,6 +1169,216 @@ void HashJoinLocalSourceState::ExternalScanHT(HashJoinGlobalSinkState &sink, Has
 	}
 }
 
+void HashJoinGlobalSourceState::InitializeDeferredProbe(ClientContext &context, HashJoinGlobalSinkState &sink) {
+	lock_guard<mutex> guard(lock);
+	if (global_stage != HashJoinSourceStage::INIT) {
+		// Another thread initialized
+		return;
+	}
+	auto &buffer_manager = BufferManager::GetBufferManager(context);
+	auto &probe_types = op.children[0]->types;
+
+	// combine the thread-local probe collections
+	deferred_probe_collection = make_uniq<ColumnDataCollection>(buffer_manager, probe_types);
+	for (auto &collection : sink.deferred_probe_collections) {
+		deferred_probe_collection->Combine(*collection);
+	}
+	sink.deferred_probe_collections.clear();
+	sink.deferred_probe_append_states.clear();
+
+	const auto probe_count = deferred_probe_collection->Count();
+	if (probe_count == 0) {
+		// inner join with an empty probe side
+		global_stage = HashJoinSourceStage::DONE;
+		return;
+	}
+
+	auto &ht = *sink.hash_table;
+	flipped = probe_count < ht.Count();
+	if (flipped) {
+		// flip the join: build a hash table on the (smaller) probe side, keyed on the left side of the conditions
+		for (auto &condition : op.conditions) {
+			JoinCondition flipped_condition;
+			flipped_condition.left = condition.right->Copy();
+			flipped_condition.right = condition.left->Copy();
+			flipped_condition.comparison = condition.comparison;
+			flipped_conditions.push_back(std::move(flipped_condition));
+		}
+		for (idx_t col_idx = 0; col_idx < probe_types.size(); col_idx++) {
+			flipped_output_columns.push_back(op.conditions.size() + col_idx);
+		}
+		flipped_hash_table = make_uniq<JoinHashTable>(buffer_manager, flipped_conditions, probe_types,
+		                                              JoinType::INNER, flipped_output_columns);
+
+		// the flipped hash table has to fit in memory next to the rows of the original build side
+		const auto flipped_row_size = probe_count * flipped_hash_table->layout.GetRowWidth();
+		const auto flipped_size = flipped_row_size + deferred_probe_collection->SizeInBytes() +
+		                          JoinHashTable::PointerTableSize(probe_count);
+		const auto build_size = ht.SizeInBytes() + JoinHashTable::PointerTableSize(ht.Count());
+		const auto required_size = ht.SizeInBytes() + flipped_size;
+		sink.temporary_memory_state->SetRemainingSize(context, required_size);
+		if (sink.temporary_memory_state->GetReservation() < required_size) {
+			// we did not get the memory: build the pointer table of the original build side after all
+			flipped = false;
+			flipped_hash_table.reset();
+			flipped_conditions.clear();
+			flipped_output_columns.clear();
+			sink.temporary_memory_state->SetRemainingSize(context, build_size);
+		}
+	}
+
+	if (!flipped) {
+		// the estimate of the probe side was off as well: build the pointer table as usual
+		ht.InitializePointerTable();
+		PrepareDeferredBuild(sink, ht);
+		return;
+	}
+
+	// the threads first insert chunks of the materialized probe side into thread-local hash tables
+	flip_chunk_idx = 0;
+	flip_chunk_count = deferred_probe_collection->ChunkCount();
+	flip_chunk_done = 0;
+
+	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+	flip_chunks_per_thread = MaxValue<idx_t>((flip_chunk_count + num_threads - 1) / num_threads, 1);
+
+	global_stage = HashJoinSourceStage::SINK_FLIPPED;
+}
+
+void HashJoinGlobalSourceState::PrepareDeferredBuild(HashJoinGlobalSinkState &sink, JoinHashTable &ht) {
+	build_chunk_idx = 0;
+	build_chunk_count = ht.GetDataCollection().ChunkCount();
+	build_chunk_done = 0;
+
+	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(sink.context).NumberOfThreads());
+	build_chunks_per_thread = MaxValue<idx_t>((build_chunk_count + num_threads - 1) / num_threads, 1);
+
+	global_stage = HashJoinSourceStage::BUILD;
+}
+
+void HashJoinGlobalSourceState::PrepareFlippedBuild(HashJoinGlobalSinkState &sink) {
+	for (auto &local_ht : flipped_local_hash_tables) {
+		flipped_hash_table->Merge(*local_ht);
+	}
+	flipped_local_hash_tables.clear();
+	deferred_probe_collection.reset();
+
+	flipped_hash_table->Unpartition();
+	flipped_hash_table->InitializePointerTable();
+	PrepareDeferredBuild(sink, *flipped_hash_table);
+}
+
+void HashJoinGlobalSourceState::PrepareDeferredProbe(HashJoinGlobalSinkState &sink) {
+	auto &ht = flipped ? *flipped_hash_table : *sink.hash_table;
+	ht.GetDataCollection().VerifyEverythingPinned();
+	ht.finalized = true;
+
+	if (flipped) {
+		// we probe with the keys and payload of the original build side
+		vector<column_t> column_ids;
+		for (column_t col_idx = 0; col_idx < op.condition_types.size() + op.payload_types.size(); col_idx++) {
+			column_ids.push_back(col_idx);
+		}
+		sink.hash_table->GetDataCollection().InitializeScan(build_scan_state, std::move(column_ids));
+	} else {
+		deferred_probe_collection->InitializeScan(deferred_probe_scan_state);
+	}
+	global_stage = HashJoinSourceStage::PROBE_DEFERRED;
+}
+
+void HashJoinLocalSourceState::SinkFlipped(HashJoinGlobalSinkState &sink, HashJoinGlobalSourceState &gstate) {
+	D_ASSERT(local_stage == HashJoinSourceStage::SINK_FLIPPED);
+	auto &op = gstate.op;
+
+	auto local_ht = make_uniq<JoinHashTable>(BufferManager::GetBufferManager(sink.context), gstate.flipped_conditions,
+	                                         op.children[0]->types, JoinType::INNER, gstate.flipped_output_columns);
+	PartitionedTupleDataAppendState append_state;
+	local_ht->GetSinkCollection().InitializeAppendState(append_state);
+	for (idx_t chunk_idx = flip_chunk_idx_from; chunk_idx < flip_chunk_idx_to; chunk_idx++) {
+		flip_chunk.Reset();
+		gstate.deferred_probe_collection->FetchChunk(chunk_idx, flip_chunk);
+		join_keys.Reset();
+		deferred_key_executor->Execute(flip_chunk, join_keys);
+		local_ht->Build(append_state, join_keys, flip_chunk);
+	}
+	local_ht->GetSinkCollection().FlushAppendState(append_state);
+
+	lock_guard<mutex> guard(gstate.lock);
+	gstate.flipped_local_hash_tables.push_back(std::move(local_ht));
+	gstate.flip_chunk_done += flip_chunk_idx_to - flip_chunk_idx_from;
+}
+
+void HashJoinLocalSourceState::DeferredProbe(ExecutionContext &context, HashJoinGlobalSinkState &sink,
+                                             HashJoinGlobalSourceState &gstate, DataChunk &chunk) {
+	auto &op = gstate.op;
+	auto &probe_types = op.children[0]->types;
+	if (!deferred_probe_initialized) {
+		auto &allocator = BufferAllocator::Get(context.client);
+		if (gstate.flipped) {
+			vector<LogicalType> build_types(op.condition_types);
+			build_types.insert(build_types.end(), op.payload_types.begin(), op.payload_types.end());
+			deferred_chunk.Initialize(allocator, build_types);
+			auto result_types = build_types;
+			result_types.insert(result_types.end(), probe_types.begin(), probe_types.end());
+			flipped_result.Initialize(allocator, result_types);
+			auto &build_column_ids = gstate.build_scan_state.scan_state.chunk_state.column_ids;
+			sink.hash_table->GetDataCollection().InitializeScan(build_local_scan, build_column_ids);
+		} else {
+			deferred_chunk.Initialize(allocator, probe_types);
+		}
+		deferred_probe_initialized = true;
+	}
+
+	while (true) {
+		if (scan_structure) {
+			if (gstate.flipped) {
+				// the probe side columns are at the back of the flipped result, the build side columns at the front
+				flipped_result.Reset();
+				scan_structure->Next(join_keys, deferred_chunk, flipped_result);
+				if (flipped_result.size() > 0) {
+					const auto build_column_count = deferred_chunk.ColumnCount();
+					for (idx_t col_idx = 0; col_idx < probe_types.size(); col_idx++) {
+						chunk.data[col_idx].Reference(flipped_result.data[build_column_count + col_idx]);
+					}
+					for (idx_t i = 0; i < op.rhs_output_columns.size(); i++) {
+						chunk.data[probe_types.size() + i].Reference(flipped_result.data[op.rhs_output_columns[i]]);
+					}
+					chunk.SetCardinality(flipped_result.size());
+					return;
+				}
+			} else {
+				scan_structure->Next(join_keys, deferred_chunk, chunk);
+				if (chunk.size() > 0) {
+					return;
+				}
+			}
+			if (!scan_structure->PointersExhausted()) {
+				continue;
+			}
+			scan_structure = nullptr;
+		}
+
+		// fetch the next chunk to probe with
+		deferred_chunk.Reset();
+		if (gstate.flipped) {
+			auto &build_collection = sink.hash_table->GetDataCollection();
+			if (!build_collection.Scan(gstate.build_scan_state, build_local_scan, deferred_chunk)) {
+				return;
+			}
+			join_keys.ReferenceColumns(deferred_chunk, join_key_indices);
+			scan_structure = gstate.flipped_hash_table->Probe(join_keys, join_key_state, probe_state);
+		} else {
+			if (!gstate.deferred_probe_collection->Scan(gstate.deferred_probe_scan_state, deferred_probe_local_scan,
+			                                            deferred_chunk)) {
+				return;
+			}
+			join_keys.Reset();
+			deferred_key_executor->Execute(deferred_chunk, join_keys);
+			scan_structure = sink.hash_table->Probe(join_keys, join_key_state, probe_state);
+		}
+	}
+}
+
 SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSourceInput &input) const {
 	auto &sink = sink_state->Cast<HashJoinGlobalSinkState>();
@@ -1023,6 +1386,43 @@ SourceResultType PhysicalHashJoin::GetData(ExecutionContext &context, DataChunk
 	auto &lstate = input.local_state.Cast<HashJoinLocalSourceState>();
 	sink.scanned_data = true;
 
+	if (sink.deferred_probe) {
+		if (gstate.global_stage == HashJoinSourceStage::INIT) {
+			gstate.InitializeDeferredProbe(context.client, sink);
+		}
+		// build the hash table in parallel before probing it
+		while (gstate.global_stage != HashJoinSourceStage::PROBE_DEFERRED &&
+		       gstate.global_stage != HashJoinSourceStage::DONE) {
+			if (!lstate.TaskFinished() || gstate.AssignTask(sink, lstate)) {
+				lstate.ExecuteTask(sink, gstate, chunk);
+			} else {
+				lock_guard<mutex> guard(gstate.lock);
+				if (gstate.TryPrepareNextStage(sink) || gstate.global_stage == HashJoinSourceStage::PROBE_DEFERRED ||
+				    gstate.global_stage == HashJoinSourceStage::DONE) {
+					for (auto &state : gstate.blocked_tasks) {
+						state.Callback();
+					}
+					gstate.blocked_tasks.clear();
+				} else {
+					gstate.blocked_tasks.push_back(input.interrupt_state);
+					return SourceResultType::BLOCKED;
+				}
+			}
+		}
+		if (gstate.global_stage == HashJoinSourceStage::PROBE_DEFERRED) {
+			lstate.DeferredProbe(context, sink, gstate, chunk);
+			if (chunk.size() > 0) {
+				return SourceResultType::HAVE_MORE_OUTPUT;
+			}
+		}
+		lock_guard<mutex> guard(gstate.lock);
+		if (!gstate.deferred_probe_finished) {
+			gstate.deferred_probe_finished = true;
+			sink.temporary_memory_state->SetRemainingSize(context.client, 0);
+		}
+		return SourceResultType::FINISHED;
+	}
+
 	if (!sink.external && !PropagatesBuildSide(join_type)) {
 		lock_guard<mutex> guard(gstate.lock);
 		if (gstate.global_stage != HashJoinSourceStage::DONE) {
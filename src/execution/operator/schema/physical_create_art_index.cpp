@@ -46,6 +46,10 @@ public:
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! Buffered keys and row IDs of sorted input, from which we construct the ART bottom-up
+	vector<ARTKey> sorted_keys;
+	vector<row_t> sorted_row_ids;
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -93,6 +97,7 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, Ope
 			throw ConstraintException("Data contains duplicates on indexed column(s)");
 		}
 	}
+	art.UnpinBuffers();
 
 	return SinkResultType::NEED_MORE_INPUT;
 }
@@ -100,23 +105,55 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, Ope
 SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
 
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	auto count = l_state.key_chunk.size();
+
+	UnifiedVectorFormat row_id_data;
+	row_identifiers.ToUnifiedFormat(count, row_id_data);
+	auto row_ids = UnifiedVectorFormat::GetData<row_t>(row_id_data);
+
+	// buffer the keys, so that we construct the ART from many sorted chunks at once
+	for (idx_t i = 0; i < count; i++) {
+		l_state.sorted_keys.push_back(l_state.keys[i]);
+		l_state.sorted_row_ids.push_back(row_ids[row_id_data.sel->get_index(i)]);
+	}
+	if (l_state.sorted_keys.size() >= SORTED_KEY_BUFFER_SIZE) {
+		ConstructFromSortedKeys(l_state);
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+void PhysicalCreateARTIndex::ConstructFromSortedKeys(LocalSinkState &l_state_p) const {
+
+	auto &l_state = l_state_p.Cast<CreateARTIndexLocalSinkState>();
 	auto &storage = table.GetStorage();
 	auto &l_index = l_state.local_index;
+	auto &keys = l_state.sorted_keys;
 
-	// create an ART from the chunk
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
-	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
-	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
-	}
+	// each thread scans the sorted data in ascending order, but we only construct an ART from a sorted run of keys
+	idx_t run_start = 0;
+	for (idx_t i = 1; i <= keys.size(); i++) {
+		if (i != keys.size() && !(keys[i - 1] > keys[i])) {
+			continue;
+		}
 
-	// merge into the local ART
-	if (!l_index->MergeIndexes(*art)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+		// construct an ART bottom-up from the run of keys
+		auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
+		                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
+		                          l_index->Cast<ART>().allocators);
+		if (!art->ConstructFromSorted(keys, l_state.sorted_row_ids.data(), run_start, i - run_start)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+
+		// merge into the local ART
+		if (!l_index->MergeIndexes(*art)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+		run_start = i;
 	}
 
-	return SinkResultType::NEED_MORE_INPUT;
+	keys.clear();
+	l_state.sorted_row_ids.clear();
+	l_state.arena_allocator.Reset();
 }
 
 SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk &chunk,
@@ -125,15 +162,16 @@ SinkResultType PhysicalCreateARTIndex::Sink(ExecutionContext &context, DataChunk
 	D_ASSERT(chunk.ColumnCount() >= 2);
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
-	l_state.arena_allocator.Reset();
 
 	// Insert the keys and their corresponding row identifiers.
 	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
 	if (sorted) {
+		// the buffered keys of sorted input live in the arena allocator until we construct the ART
 		ART::GenerateKeys<true>(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 		return SinkSorted(row_identifiers, input);
 	}
 
+	l_state.arena_allocator.Reset();
 	ART::GenerateKeys(l_state.arena_allocator, l_state.key_chunk, l_state.keys);
 	return SinkUnsorted(row_identifiers, input);
 }
@@ -144,6 +182,11 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
 
+	// construct the ART from the remaining sorted keys
+	if (!l_state.sorted_keys.empty()) {
+		ConstructFromSortedKeys(l_state);
+	}
+
 	// merge the local index into the global index
 	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
 		throw ConstraintException("Data contains duplicates on indexed column(s)");
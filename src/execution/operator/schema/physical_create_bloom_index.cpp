@@ -0,0 +1,56 @@
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateBloomIndex::PhysicalCreateBloomIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                   const vector<column_t> &column_ids,
+                                                   unique_ptr<CreateIndexInfo> info,
+                                                   vector<unique_ptr<Expression>> unbound_expressions,
+                                                   idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+	// convert virtual column ids to storage column ids
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+SourceResultType PhysicalCreateBloomIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                   OperatorSourceInput &input) const {
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context.client), *info, table).get();
+	if (!index_entry) {
+		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
+		// index already exists, but error ignored because of IF NOT EXISTS
+		return SourceResultType::FINISHED;
+	}
+
+	// build the Bloom filters of the existing row groups, then add the index to the storage
+	// the row groups that are appended to from here on receive their Bloom filters in the next checkpoint
+	auto filter_size = storage.BuildBloomFilters(storage_ids);
+	auto index = make_uniq<BloomIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                   TableIOManager::Get(storage), unbound_expressions, storage.db);
+	index->SetInMemorySize(filter_size);
+	index_entry->Cast<DuckIndexEntry>().initial_index_size = filter_size;
+	storage.AddIndex(std::move(index));
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
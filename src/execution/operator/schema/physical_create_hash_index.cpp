@@ -0,0 +1,139 @@
+#include "duckdb/execution/operator/schema/physical_create_hash_index.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_index_entry.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/execution/index/hash_index.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+
+namespace duckdb {
+
+PhysicalCreateHashIndex::PhysicalCreateHashIndex(LogicalOperator &op, TableCatalogEntry &table_p,
+                                                 const vector<column_t> &column_ids, unique_ptr<CreateIndexInfo> info,
+                                                 vector<unique_ptr<Expression>> unbound_expressions,
+                                                 idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::CREATE_INDEX, op.types, estimated_cardinality),
+      table(table_p.Cast<DuckTableEntry>()), info(std::move(info)),
+      unbound_expressions(std::move(unbound_expressions)) {
+
+	// convert virtual column ids to storage column ids
+	for (auto &column_id : column_ids) {
+		storage_ids.push_back(table.GetColumns().LogicalToPhysical(LogicalIndex(column_id)).index);
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+
+class CreateHashIndexGlobalSinkState : public GlobalSinkState {
+public:
+	//! Global index to be added to the table
+	unique_ptr<BoundIndex> global_index;
+};
+
+class CreateHashIndexLocalSinkState : public LocalSinkState {
+public:
+	unique_ptr<BoundIndex> local_index;
+	DataChunk key_chunk;
+	vector<column_t> key_column_ids;
+};
+
+unique_ptr<GlobalSinkState> PhysicalCreateHashIndex::GetGlobalSinkState(ClientContext &context) const {
+	auto state = make_uniq<CreateHashIndexGlobalSinkState>();
+
+	// create the global index
+	auto &storage = table.GetStorage();
+	state->global_index = make_uniq<HashIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                           TableIOManager::Get(storage), unbound_expressions, storage.db);
+	return std::move(state);
+}
+
+unique_ptr<LocalSinkState> PhysicalCreateHashIndex::GetLocalSinkState(ExecutionContext &context) const {
+	auto state = make_uniq<CreateHashIndexLocalSinkState>();
+
+	// create the local index
+	auto &storage = table.GetStorage();
+	state->local_index = make_uniq<HashIndex>(info->index_name, info->constraint_type, storage_ids,
+	                                          TableIOManager::Get(storage), unbound_expressions, storage.db);
+
+	state->key_chunk.Initialize(Allocator::Get(context.client), state->local_index->logical_types);
+	for (idx_t i = 0; i < state->key_chunk.ColumnCount(); i++) {
+		state->key_column_ids.push_back(i);
+	}
+	return std::move(state);
+}
+
+SinkResultType PhysicalCreateHashIndex::Sink(ExecutionContext &context, DataChunk &chunk,
+                                             OperatorSinkInput &input) const {
+
+	D_ASSERT(chunk.ColumnCount() >= 2);
+	auto &l_state = input.local_state.Cast<CreateHashIndexLocalSinkState>();
+	l_state.key_chunk.ReferenceColumns(chunk, l_state.key_column_ids);
+
+	// insert the keys and their corresponding row identifiers
+	auto &row_identifiers = chunk.data[chunk.ColumnCount() - 1];
+	IndexLock index_lock;
+	l_state.local_index->InitializeLock(index_lock);
+	auto error = l_state.local_index->Insert(index_lock, l_state.key_chunk, row_identifiers);
+	if (error.HasError()) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalCreateHashIndex::Combine(ExecutionContext &context,
+                                                       OperatorSinkCombineInput &input) const {
+
+	auto &g_state = input.global_state.Cast<CreateHashIndexGlobalSinkState>();
+	auto &l_state = input.local_state.Cast<CreateHashIndexLocalSinkState>();
+
+	// merge the local index into the global index
+	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
+		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	}
+	return SinkCombineResultType::FINISHED;
+}
+
+SinkFinalizeType PhysicalCreateHashIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
+                                                   OperatorSinkFinalizeInput &input) const {
+
+	// here, we set the resulting global index as the newly created index of the table
+	auto &state = input.global_state.Cast<CreateHashIndexGlobalSinkState>();
+	D_ASSERT(state.global_index->VerifyAndToString(true).empty());
+
+	auto &storage = table.GetStorage();
+	if (!storage.IsRoot()) {
+		throw TransactionException("Transaction conflict: cannot add an index to a table that has been altered!");
+	}
+
+	auto &schema = table.schema;
+	info->column_ids = storage_ids;
+	auto index_entry = schema.CreateIndex(schema.GetCatalogTransaction(context), *info, table).get();
+	if (!index_entry) {
+		D_ASSERT(info->on_conflict == OnCreateConflict::IGNORE_ON_CONFLICT);
+		// index already exists, but error ignored because of IF NOT EXISTS
+		return SinkFinalizeType::READY;
+	}
+	auto &index = index_entry->Cast<DuckIndexEntry>();
+	index.initial_index_size = state.global_index->GetInMemorySize();
+
+	// add index to storage
+	storage.AddIndex(std::move(state.global_index));
+	return SinkFinalizeType::READY;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+
+SourceResultType PhysicalCreateHashIndex::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                  OperatorSourceInput &input) const {
+	return SourceResultType::FINISHED;
+}
+
+} // namespace duckdb
@@ -123,6 +123,7 @@ idx_t PhysicalOperator::GetMaxThreadMemory(ClientContext &context) {
 	// Memory usage per thread should scale with max mem / num threads
 	// We take 1/4th of this, to be conservative
 	auto max_memory = BufferManager::GetBufferManager(context).GetQueryMaxMemory();
+	max_memory = MinValue<idx_t>(max_memory, ClientConfig::GetConfig(context).connection_operator_memory_limit);
 	auto num_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
 	return (max_memory / num_threads) / 4;
 }
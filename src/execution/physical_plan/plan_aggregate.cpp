@@ -2,6 +2,7 @@
 #include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/execution/operator/aggregate/physical_hash_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_perfecthash_aggregate.hpp"
+#include "duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp"
 #include "duckdb/execution/operator/aggregate/physical_ungrouped_aggregate.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
@@ -9,8 +10,10 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parser/expression/comparison_expression.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_order.hpp"
 
 namespace duckdb {
 
@@ -149,10 +152,89 @@ static bool CanUsePerfectHashAggregate(ClientContext &context, LogicalAggregate
 	return true;
 }
 
+//! Get the column that is referenced by a projection expression, if the projection preserves the order and the
+//! distinctness of that column (i.e., it is a plain reference, or (de)compresses a compressed materialization)
+static bool GetOrderPreservingColumn(Expression &expr, idx_t &column) {
+	if (expr.type == ExpressionType::BOUND_REF) {
+		column = expr.Cast<BoundReferenceExpression>().index;
+		return true;
+	}
+	if (expr.type == ExpressionType::BOUND_FUNCTION) {
+		// the compressed materialization functions are order-preserving, the integral variants take the minimum
+		// value as an additional constant argument
+		auto &function = expr.Cast<BoundFunctionExpression>();
+		auto &name = function.function.name;
+		if ((StringUtil::StartsWith(name, "__internal_compress") ||
+		     StringUtil::StartsWith(name, "__internal_decompress")) &&
+		    !function.children.empty()) {
+			return GetOrderPreservingColumn(*function.children[0], column);
+		}
+	}
+	return false;
+}
+
+static bool CanUseStreamingAggregate(LogicalAggregate &op) {
+	if (op.groups.empty() || op.grouping_sets.size() > 1 || !op.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expression : op.expressions) {
+		auto &aggregate = expression->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			return false;
+		}
+	}
+	// figure out which columns of the input we group on
+	vector<idx_t> group_columns;
+	for (auto &group : op.groups) {
+		if (group->type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		group_columns.push_back(group->Cast<BoundReferenceExpression>().index);
+	}
+	// trace them through any projections until we reach an ORDER BY
+	reference<LogicalOperator> child = *op.children[0];
+	while (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		for (auto &column : group_columns) {
+			if (!GetOrderPreservingColumn(*child.get().expressions[column], column)) {
+				return false;
+			}
+		}
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_ORDER_BY) {
+		return false;
+	}
+	auto &order = child.get().Cast<LogicalOrder>();
+	if (!order.projections.empty()) {
+		for (auto &column : group_columns) {
+			column = order.projections[column];
+		}
+	}
+	// the input is sorted on the groups if the leading orders are distinct group columns (in any order) that cover
+	// every group column
+	unordered_set<idx_t> remaining_columns(group_columns.begin(), group_columns.end());
+	for (idx_t order_idx = 0; !remaining_columns.empty(); order_idx++) {
+		if (order_idx >= order.orders.size()) {
+			return false;
+		}
+		auto &order_expr = *order.orders[order_idx].expression;
+		if (order_expr.type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		if (remaining_columns.erase(order_expr.Cast<BoundReferenceExpression>().index) == 0) {
+			// not a group column, or a group column that was already ordered on
+			return false;
+		}
+	}
+	return true;
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate &op) {
 	unique_ptr<PhysicalOperator> groupby;
 	D_ASSERT(op.children.size() == 1);
 
+	// check whether the input is sorted on the groups before the child is planned
+	const auto use_streaming_aggregate = CanUseStreamingAggregate(op);
 	auto plan = CreatePlan(*op.children[0]);
 
 	plan = ExtractAggregateExpressions(std::move(plan), op.expressions, op.groups);
@@ -180,7 +262,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalAggregate
 		// groups! create a GROUP BY aggregator
 		// use a perfect hash aggregate if possible
 		vector<idx_t> required_bits;
-		if (CanUsePerfectHashAggregate(context, op, required_bits)) {
+		if (use_streaming_aggregate) {
+			// the input is sorted on the groups: stream the groups instead of building a hash table
+			groupby = make_uniq_base<PhysicalOperator, PhysicalStreamingAggregate>(
+			    op.types, std::move(op.expressions), std::move(op.groups), op.estimated_cardinality);
+		} else if (CanUsePerfectHashAggregate(context, op, required_bits)) {
 			groupby = make_uniq_base<PhysicalOperator, PhysicalPerfectHashAggregate>(
 			    context, op.types, std::move(op.expressions), std::move(op.groups), std::move(op.group_stats),
 			    std::move(required_bits), op.estimated_cardinality);
@@ -1,15 +1,22 @@
+#include "duckdb/catalog/catalog.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/filter/physical_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/operator/schema/physical_create_art_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_bloom_index.hpp"
+#include "duckdb/execution/operator/schema/physical_create_hash_index.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/execution/index/hash_index.hpp"
 #include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_create_index.hpp"
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/planner/expression/bound_operator_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -18,7 +25,6 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	// table scan - projection (for expression execution) - filter (NOT NULL) - order (if applicable) - create index
 
 	D_ASSERT(op.children.size() == 1);
-	auto table_scan = CreatePlan(*op.children[0]);
 
 	// validate that all expressions contain valid scalar functions
 	// e.g. get_current_timestamp(), random(), and sequence values are not allowed as index keys
@@ -30,10 +36,52 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 		}
 	}
 
-	// if we get here and the index type is not ART, we throw an exception
+	if ((op.info->index_type == BloomIndex::TYPE_NAME || op.info->index_type == HashIndex::TYPE_NAME) &&
+	    !op.table.catalog.InMemory()) {
+		// older versions cannot read Bloom filter and hash indexes: they can only be created in a database file if the
+		// storage compatibility version allows it
+		auto required_version = op.info->index_type == BloomIndex::TYPE_NAME ? BloomIndex::SERIALIZATION_VERSION
+		                                                                     : HashIndex::SERIALIZATION_VERSION;
+		auto &config = DBConfig::GetConfig(context);
+		if (!config.options.serialization_compatibility.Compare(required_version)) {
+			throw BinderException("%s indexes cannot be read by DuckDB %s: SET storage_compatibility_version = "
+			                      "'latest' to create them",
+			                      op.info->index_type, config.options.serialization_compatibility.duckdb_version);
+		}
+	}
+	if (op.info->index_type == BloomIndex::TYPE_NAME) {
+		// Bloom filter indexes are built directly from the row groups of the table: they do not need a table scan
+		if (op.info->constraint_type != IndexConstraintType::NONE) {
+			throw BinderException("Bloom filter indexes cannot be UNIQUE");
+		}
+		for (auto &expr : op.unbound_expressions) {
+			if (expr->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+				throw BinderException("Bloom filter indexes can only be created on columns, not on expressions");
+			}
+			if (!BloomFilter::TypeIsSupported(expr->return_type)) {
+				throw BinderException("Bloom filter indexes are not supported for columns of type %s",
+				                      expr->return_type.ToString());
+			}
+		}
+		dependencies.AddDependency(op.table);
+		return make_uniq<PhysicalCreateBloomIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                           std::move(op.unbound_expressions), op.estimated_cardinality);
+	}
+	if (op.info->index_type == HashIndex::TYPE_NAME) {
+		if (op.unbound_expressions.size() != 1) {
+			throw BinderException("Hash indexes can only be created on a single key");
+		}
+		auto &key_type = op.unbound_expressions[0]->return_type;
+		if (!HashIndex::TypeIsSupported(key_type)) {
+			throw BinderException("Hash indexes are not supported for keys of type %s", key_type.ToString());
+		}
+	}
+	auto table_scan = CreatePlan(*op.children[0]);
+
+	// if we get here and the index type is not ART or HASH, we throw an exception
 	// because we don't support any other index type yet. However, an operator extension could have
 	// replaced this part of the plan with a different index creation operator.
-	if (op.info->index_type != ART::TYPE_NAME) {
+	if (op.info->index_type != ART::TYPE_NAME && op.info->index_type != HashIndex::TYPE_NAME) {
 		throw BinderException("Unknown index type: " + op.info->index_type);
 	}
 
@@ -76,15 +124,19 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalCreateInde
 	null_filter->types.emplace_back(LogicalType::ROW_TYPE);
 	null_filter->children.push_back(std::move(projection));
 
-	// determine if we sort the data prior to index creation
-	// we don't sort, if either VARCHAR or compound key
-	auto perform_sorting = true;
-	if (op.unbound_expressions.size() > 1) {
-		perform_sorting = false;
-	} else if (op.unbound_expressions[0]->return_type.InternalType() == PhysicalType::VARCHAR) {
-		perform_sorting = false;
+	if (op.info->index_type == HashIndex::TYPE_NAME) {
+		// the hash index does not benefit from sorted input
+		auto physical_create_index =
+		    make_uniq<PhysicalCreateHashIndex>(op, op.table, op.info->column_ids, std::move(op.info),
+		                                       std::move(op.unbound_expressions), op.estimated_cardinality);
+		physical_create_index->children.push_back(std::move(null_filter));
+		return std::move(physical_create_index);
 	}
 
+	// we sort the data prior to index creation, which allows constructing the ART bottom-up instead of inserting
+	// each key, also for VARCHAR and compound keys: the order of their ART keys matches the sort order
+	auto perform_sorting = true;
+
 	// actual physical create index operator
 
 	auto physical_create_index =
@@ -142,6 +142,9 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+	//! If the thread-local HT holds more than this fraction of the rows sunk into it, pre-aggregation does not reduce
+	//! the data enough to be worth the lookups, and we skip them
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.95;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -327,12 +330,15 @@ public:
 	unique_ptr<GroupedAggregateHashTable> ht;
 	//! Chunk with group columns
 	DataChunk group_chunk;
+	//! Number of rows sunk since the HT was last reset
+	idx_t sink_count;
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -435,6 +441,22 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+void DecideAdaptation(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate) {
+	auto &ht = *lstate.ht;
+	if (gstate.number_of_threads <= 2 || ht.SkipLookups() || lstate.sink_count == 0) {
+		// We only reset the HT with many threads, otherwise the thread-local HT is (almost) the final aggregate
+		return;
+	}
+	// The HT is full: check how much pre-aggregation has reduced the rows that were sunk into it
+	const auto unique_fraction = static_cast<double>(ht.Count()) / static_cast<double>(lstate.sink_count);
+	if (unique_fraction >= gstate.config.SKIP_LOOKUPS_THRESHOLD) {
+		// Barely any reduction, from now on, just partition the rows, and aggregate them in the Finalize
+		ht.ClearPointerTable();
+		ht.ResetCount();
+		ht.SetSkipLookups(true);
+	}
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -449,11 +471,29 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += chunk.size();
+
+	if (ht.SkipLookups()) {
+		// The HT does not fill up, so we periodically check whether we need to repartition
+		if (lstate.sink_count + STANDARD_VECTOR_SIZE >= ht.ResizeThreshold()) {
+			lstate.sink_count = 0;
+			MaybeRepartition(context.client, gstate, lstate);
+		}
+		return;
+	}
 
 	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
+	// Decide whether to keep doing lookups, then start counting from scratch
+	DecideAdaptation(gstate, lstate);
+	lstate.sink_count = 0;
+	if (ht.SkipLookups()) {
+		MaybeRepartition(context.client, gstate, lstate);
+		return;
+	}
+
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
@@ -837,6 +837,7 @@ public:
 	bool IsConstantAggregate();
 	bool IsCustomAggregate();
 	bool IsDistinctAggregate();
+	bool IsSlidingAggregate();
 
 	WindowAggregateExecutorGlobalState(const WindowAggregateExecutor &executor, const idx_t payload_count,
 	                                   const ValidityMask &partition_mask, const ValidityMask &order_mask);
@@ -920,6 +921,41 @@ bool WindowAggregateExecutorGlobalState::IsDistinctAggregate() {
 	return wexpr.distinct;
 }
 
+static bool IsSlidingBoundary(WindowBoundary boundary, const unique_ptr<Expression> &offset) {
+	switch (boundary) {
+	case WindowBoundary::UNBOUNDED_PRECEDING:
+	case WindowBoundary::UNBOUNDED_FOLLOWING:
+	case WindowBoundary::CURRENT_ROW_ROWS:
+		return true;
+	case WindowBoundary::EXPR_PRECEDING_ROWS:
+	case WindowBoundary::EXPR_FOLLOWING_ROWS:
+		return offset && offset->IsFoldable();
+	default:
+		return false;
+	}
+}
+
+bool WindowAggregateExecutorGlobalState::IsSlidingAggregate() {
+	const auto &wexpr = executor.wexpr;
+	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
+
+	if (!wexpr.aggregate || wexpr.distinct || mode != WindowAggregationMode::WINDOW) {
+		return false;
+	}
+	if (wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
+		return false;
+	}
+
+	//	The running state is updated by removing the rows that leave the frame
+	const auto &function = AggregateObject(wexpr).function;
+	if (!function.remove || function.destructor) {
+		return false;
+	}
+
+	//	ROWS frames with constant offsets only ever move forward within a partition
+	return IsSlidingBoundary(wexpr.start, wexpr.start_expr) && IsSlidingBoundary(wexpr.end, wexpr.end_expr);
+}
+
 bool WindowAggregateExecutorGlobalState::IsCustomAggregate() {
 	const auto &wexpr = executor.wexpr;
 	const auto &mode = reinterpret_cast<const WindowAggregateExecutor &>(executor).mode;
@@ -976,6 +1012,9 @@ WindowAggregateExecutorGlobalState::WindowAggregateExecutorGlobalState(const Win
 		aggregator = make_uniq<WindowConstantAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else if (IsCustomAggregate()) {
 		aggregator = make_uniq<WindowCustomAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
+	} else if (IsSlidingAggregate()) {
+		// slide a single state along the frames, adding and removing rows
+		aggregator = make_uniq<WindowSlidingAggregator>(aggr, arg_types, return_type, wexpr.exclude_clause);
 	} else {
 		// build a segment tree for frame-adhering aggregates
 		// see http://www.vldb.org/pvldb/vol8/p1058-leis.pdf
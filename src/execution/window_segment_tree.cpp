@@ -696,6 +696,241 @@ void WindowNaiveAggregator::Evaluate(const WindowAggregatorState &gsink, WindowA
 	lnstate.Evaluate(gnstate, bounds, result, count, row_idx);
 }
 
+//===--------------------------------------------------------------------===//
+// WindowSlidingAggregator
+//===--------------------------------------------------------------------===//
+WindowSlidingAggregator::WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types,
+                                                 const LogicalType &result_type, const WindowExcludeMode exclude_mode)
+    : WindowAggregator(std::move(aggr), arg_types, result_type, exclude_mode) {
+	D_ASSERT(this->aggr.function.remove);
+}
+
+WindowSlidingAggregator::~WindowSlidingAggregator() {
+}
+
+class WindowSlidingGlobalState : public WindowAggregatorGlobalState {
+public:
+	WindowSlidingGlobalState(const WindowSlidingAggregator &aggregator, idx_t group_count)
+	    : WindowAggregatorGlobalState(aggregator, group_count) {
+	}
+
+	//! The number of rows before each row that pass the filter and have no NULL arguments
+	vector<idx_t> valid_counts;
+};
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetGlobalState(idx_t group_count,
+                                                                          const ValidityMask &) const {
+	return make_uniq<WindowSlidingGlobalState>(*this, group_count);
+}
+
+void WindowSlidingAggregator::Finalize(WindowAggregatorState &gsink, const FrameStats &stats) {
+	WindowAggregator::Finalize(gsink, stats);
+
+	//	Frames without any contributing rows have to produce the value of an empty aggregate,
+	//	which removing rows from a running state does not restore (e.g., SUM would return 0 instead of NULL).
+	auto &gssink = gsink.Cast<WindowSlidingGlobalState>();
+	auto &inputs = gssink.inputs;
+	auto &filter_mask = gssink.filter_mask;
+	const auto input_count = inputs.size();
+
+	vector<UnifiedVectorFormat> input_formats(inputs.ColumnCount());
+	for (idx_t c = 0; c < inputs.ColumnCount(); ++c) {
+		inputs.data[c].ToUnifiedFormat(input_count, input_formats[c]);
+	}
+
+	auto &valid_counts = gssink.valid_counts;
+	valid_counts.resize(input_count + 1);
+	valid_counts[0] = 0;
+	for (idx_t i = 0; i < input_count; ++i) {
+		bool valid = filter_mask.RowIsValid(i);
+		for (idx_t c = 0; valid && c < input_formats.size(); ++c) {
+			valid = input_formats[c].validity.RowIsValid(input_formats[c].sel->get_index(i));
+		}
+		valid_counts[i + 1] = valid_counts[i] + valid;
+	}
+}
+
+class WindowSlidingState : public WindowAggregatorState {
+public:
+	explicit WindowSlidingState(const WindowSlidingAggregator &aggregator);
+
+	void Evaluate(const WindowSlidingGlobalState &gsink, const DataChunk &bounds, Vector &result, idx_t count);
+
+protected:
+	//! Buffer the update (or removal) of a row
+	void BufferRow(const WindowSlidingGlobalState &gsink, data_ptr_t delta, idx_t row, bool remove);
+	//! Flush the buffered updates (or removals) into the delta states
+	void FlushStates(const WindowSlidingGlobalState &gsink, bool remove);
+	//! Combine a single source state into a single target state
+	void CombineState(data_ptr_t source, data_ptr_t target);
+
+	//! The aggregator
+	const WindowSlidingAggregator &aggregator;
+	//! The running aggregate state of the current frame
+	vector<data_t> running;
+	//! The frame the running state covers
+	idx_t frame_begin;
+	idx_t frame_end;
+	//! Data pointer that contains a vector of states, holding the change of the running state for each row
+	vector<data_t> deltas;
+	//! Reused result state container for the aggregate
+	Vector statef;
+	//! Whether the delta state of a row restarts the running state, instead of applying to the previous row
+	vector<bool> restarts;
+	//! Pointers to the delta states, used for buffering the rows that enter and leave the frames
+	Vector add_states;
+	Vector remove_states;
+	//! The rows being added and removed
+	SelectionVector add_sel;
+	SelectionVector remove_sel;
+	//! Count of buffered rows
+	idx_t add_count;
+	idx_t remove_count;
+	//! Single state pointers for combining states
+	Vector source;
+	Vector target;
+	//! Input data chunk, used for slicing the buffered rows
+	DataChunk leaves;
+};
+
+WindowSlidingState::WindowSlidingState(const WindowSlidingAggregator &aggregator_p)
+    : aggregator(aggregator_p), running(aggregator.state_size), frame_begin(0), frame_end(0),
+      deltas(aggregator.state_size * STANDARD_VECTOR_SIZE), statef(LogicalType::POINTER),
+      restarts(STANDARD_VECTOR_SIZE, false), add_states(LogicalType::POINTER), remove_states(LogicalType::POINTER),
+      add_count(0), remove_count(0), source(LogicalType::POINTER), target(LogicalType::POINTER) {
+	aggregator.aggr.function.initialize(running.data());
+
+	add_sel.Initialize();
+	remove_sel.Initialize();
+
+	//	Build the finalise vector that just points to the delta states
+	data_ptr_t state_ptr = deltas.data();
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; ++i) {
+		fdata[i] = state_ptr;
+		state_ptr += aggregator.state_size;
+	}
+}
+
+void WindowSlidingState::FlushStates(const WindowSlidingGlobalState &gsink, bool remove) {
+	auto &flush_count = remove ? remove_count : add_count;
+	if (!flush_count) {
+		return;
+	}
+
+	auto &inputs = gsink.inputs;
+	leaves.Slice(inputs, remove ? remove_sel : add_sel, flush_count);
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	if (remove) {
+		aggr.function.remove(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), remove_states, flush_count);
+	} else {
+		aggr.function.update(leaves.data.data(), aggr_input_data, leaves.ColumnCount(), add_states, flush_count);
+	}
+
+	flush_count = 0;
+}
+
+void WindowSlidingState::BufferRow(const WindowSlidingGlobalState &gsink, data_ptr_t delta, idx_t row, bool remove) {
+	if (!gsink.filter_mask.RowIsValid(row)) {
+		return;
+	}
+
+	auto &flush_count = remove ? remove_count : add_count;
+	auto pdata = FlatVector::GetData<data_ptr_t>(remove ? remove_states : add_states);
+	auto &sel = remove ? remove_sel : add_sel;
+	pdata[flush_count] = delta;
+	sel[flush_count++] = UnsafeNumericCast<sel_t>(row);
+	if (flush_count >= STANDARD_VECTOR_SIZE) {
+		FlushStates(gsink, remove);
+	}
+}
+
+void WindowSlidingState::CombineState(data_ptr_t source_state, data_ptr_t target_state) {
+	FlatVector::GetData<data_ptr_t>(source)[0] = source_state;
+	FlatVector::GetData<data_ptr_t>(target)[0] = target_state;
+
+	auto &aggr = aggregator.aggr;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.combine(source, target, aggr_input_data, 1);
+}
+
+void WindowSlidingState::Evaluate(const WindowSlidingGlobalState &gsink, const DataChunk &bounds, Vector &result,
+                                  idx_t count) {
+	auto &aggr = aggregator.aggr;
+	auto &inputs = gsink.inputs;
+	auto &valid_counts = gsink.valid_counts;
+
+	if (leaves.ColumnCount() == 0 && inputs.ColumnCount() > 0) {
+		leaves.Initialize(Allocator::DefaultAllocator(), inputs.GetTypes());
+	}
+
+	auto begins = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_BEGIN]);
+	auto ends = FlatVector::GetData<const idx_t>(bounds.data[WINDOW_END]);
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+
+	//	Collect the rows that enter and leave the frame of each row into a delta state per row.
+	//	If the frame jumps (e.g., to the next partition), the running state is restarted instead.
+	for (idx_t i = 0; i < count; ++i) {
+		auto delta = fdata[i];
+		aggr.function.initialize(delta);
+
+		const auto begin = begins[i];
+		const auto end = MaxValue(begins[i], ends[i]);
+		restarts[i] = (begin < frame_begin || end < frame_end || begin >= frame_end);
+		if (restarts[i]) {
+			for (auto f = begin; f < end; ++f) {
+				BufferRow(gsink, delta, f, false);
+			}
+		} else {
+			for (auto f = frame_begin; f < begin; ++f) {
+				BufferRow(gsink, delta, f, true);
+			}
+			for (auto f = frame_end; f < end; ++f) {
+				BufferRow(gsink, delta, f, false);
+			}
+		}
+		frame_begin = begin;
+		frame_end = end;
+	}
+	FlushStates(gsink, false);
+	FlushStates(gsink, true);
+
+	//	Apply the deltas to the running state, one row after the other
+	for (idx_t i = 0; i < count; ++i) {
+		if (!restarts[i]) {
+			CombineState(i ? fdata[i - 1] : running.data(), fdata[i]);
+		}
+	}
+	if (count) {
+		aggr.function.initialize(running.data());
+		CombineState(fdata[count - 1], running.data());
+	}
+
+	//	Frames without contributing rows produce the empty aggregate
+	for (idx_t i = 0; i < count; ++i) {
+		if (ends[i] <= begins[i] || valid_counts[ends[i]] == valid_counts[begins[i]]) {
+			aggr.function.initialize(fdata[i]);
+		}
+	}
+
+	//	Finalise the result aggregates and write to the result
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	aggr.function.finalize(statef, aggr_input_data, result, count, 0);
+}
+
+unique_ptr<WindowAggregatorState> WindowSlidingAggregator::GetLocalState() const {
+	return make_uniq<WindowSlidingState>(*this);
+}
+
+void WindowSlidingAggregator::Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate,
+                                       const DataChunk &bounds, Vector &result, idx_t count, idx_t row_idx) const {
+	const auto &gssink = gsink.Cast<WindowSlidingGlobalState>();
+	auto &lsstate = lstate.Cast<WindowSlidingState>();
+	lsstate.Evaluate(gssink, bounds, result, count);
+}
+
 //===--------------------------------------------------------------------===//
 // WindowSegmentTree
 //===--------------------------------------------------------------------===//
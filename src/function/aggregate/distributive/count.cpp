@@ -208,6 +208,18 @@ struct CountFunction : public BaseCountFunction {
 		}
 		}
 	}
+
+	static void CountRemove(Vector inputs[], AggregateInputData &, idx_t input_count, Vector &states, idx_t count) {
+		UnifiedVectorFormat idata, sdata;
+		inputs[0].ToUnifiedFormat(count, idata);
+		states.ToUnifiedFormat(count, sdata);
+		auto state_ptrs = UnifiedVectorFormat::GetData<STATE *>(sdata);
+		for (idx_t i = 0; i < count; i++) {
+			if (idata.validity.RowIsValid(idata.sel->get_index(i))) {
+				*state_ptrs[sdata.sel->get_index(i)] -= 1;
+			}
+		}
+	}
 };
 
 AggregateFunction CountFun::GetFunction() {
@@ -218,6 +230,7 @@ AggregateFunction CountFun::GetFunction() {
 	                      FunctionNullHandling::SPECIAL_HANDLING, CountFunction::CountUpdate);
 	fun.name = "count";
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	fun.remove = CountFunction::CountRemove;
 	return fun;
 }
 
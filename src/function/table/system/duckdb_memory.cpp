@@ -22,6 +22,12 @@ static unique_ptr<FunctionData> DuckDBMemoryBind(ClientContext &context, TableFu
 	names.emplace_back("temporary_storage_bytes");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("evicted_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("protected_blocks");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -51,6 +57,10 @@ void DuckDBMemoryFunction(ClientContext &context, TableFunctionInput &data_p, Da
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
 		// temporary_storage_bytes, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evicted_data)));
+		// evicted_blocks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.evicted_blocks)));
+		// protected_blocks, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.protected_blocks)));
 		count++;
 	}
 	output.SetCardinality(count);
@@ -19,6 +19,12 @@ static unique_ptr<FunctionData> DuckDBTemporaryFilesBind(ClientContext &context,
 	names.emplace_back("size");
 	return_types.emplace_back(LogicalType::BIGINT);
 
+	names.emplace_back("block_size");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("bytes_saved");
+	return_types.emplace_back(LogicalType::BIGINT);
+
 	return nullptr;
 }
 
@@ -46,6 +52,10 @@ void DuckDBTemporaryFilesFunction(ClientContext &context, TableFunctionInput &da
 		output.SetValue(col++, count, entry.path);
 		// database_oid, BIGINT
 		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.size)));
+		// block_size, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.block_size)));
+		// bytes_saved, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.bytes_saved)));
 		count++;
 	}
 	output.SetCardinality(count);
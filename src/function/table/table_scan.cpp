@@ -6,6 +6,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/hash_index.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_config.hpp"
@@ -293,6 +294,50 @@ static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &ex
 	    expr, [&](Expression &child) { RewriteIndexExpression(index, get, child, rewrite_possible); });
 }
 
+//! Tries to convert the table scan into an index scan on the given (ART or hash) index. Returns true, if the index
+//! matches the filters
+template <class T>
+static bool TryIndexScan(ClientContext &context, LogicalGet &get, TableScanBindData &bind_data,
+                         Transaction &transaction, T &index, vector<unique_ptr<Expression>> &filters) {
+	// first rewrite the index expressions so the ColumnBindings align with the column bindings of the current table
+	vector<unique_ptr<Expression>> index_expressions;
+	for (auto &unbound_expression : index.unbound_expressions) {
+		auto index_expression = unbound_expression->Copy();
+		bool rewrite_possible = true;
+		RewriteIndexExpression(index, get, *index_expression, rewrite_possible);
+		if (!rewrite_possible) {
+			// could not rewrite!
+			return false;
+		}
+		index_expressions.push_back(std::move(index_expression));
+	}
+
+	// Try to find matching filter expressions for the index.
+	auto index_state = index.TryInitializeScan(transaction, index_expressions, filters);
+	if (!index_state) {
+		return false;
+	}
+
+	auto &storage = bind_data.table.GetStorage();
+	auto &db_config = DBConfig::GetConfig(context);
+	auto index_scan_percentage = db_config.options.index_scan_percentage;
+	auto index_scan_max_count = db_config.options.index_scan_max_count;
+
+	auto total_rows = storage.GetTotalRows();
+	auto total_rows_from_percentage = NumericCast<idx_t>(double(total_rows) * index_scan_percentage);
+	auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
+
+	// Check if we can use an index scan, and already retrieve the matching row ids.
+	if (index.Scan(transaction, storage, *index_state, max_count, bind_data.row_ids)) {
+		bind_data.is_index_scan = true;
+		get.function = TableScanFunction::GetIndexScanFunction();
+		return true;
+	}
+
+	bind_data.row_ids.clear();
+	return true;
+}
+
 void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, FunctionData *bind_data_p,
                                     vector<unique_ptr<Expression>> &filters) {
 	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
@@ -325,47 +370,15 @@ void TableScanPushdownComplexFilter(ClientContext &context, LogicalGet &get, Fun
 	auto &info = storage.GetDataTableInfo();
 	auto &transaction = Transaction::Get(context, bind_data.table.catalog);
 
-	// bind and scan any ART indexes
+	// bind and scan any ART indexes, and then any hash indexes
 	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
-		// first rewrite the index expression so the ColumnBindings align with the column bindings of the current table
-		if (art_index.unbound_expressions.size() > 1) {
-			// NOTE: index scans are not (yet) supported for compound index keys
-			return false;
-		}
-
-		auto index_expression = art_index.unbound_expressions[0]->Copy();
-		bool rewrite_possible = true;
-		RewriteIndexExpression(art_index, get, *index_expression, rewrite_possible);
-		if (!rewrite_possible) {
-			// could not rewrite!
-			return false;
-		}
-
-		// Try to find a matching index for any of the filter expressions.
-		for (auto &filter : filters) {
-			auto index_state = art_index.TryInitializeScan(transaction, *index_expression, *filter);
-			if (index_state != nullptr) {
-
-				auto &db_config = DBConfig::GetConfig(context);
-				auto index_scan_percentage = db_config.options.index_scan_percentage;
-				auto index_scan_max_count = db_config.options.index_scan_max_count;
-
-				auto total_rows = storage.GetTotalRows();
-				auto total_rows_from_percentage = NumericCast<idx_t>(double(total_rows) * index_scan_percentage);
-				auto max_count = MaxValue(index_scan_max_count, total_rows_from_percentage);
-
-				// Check if we can use an index scan, and already retrieve the matching row ids.
-				if (art_index.Scan(transaction, storage, *index_state, max_count, bind_data.row_ids)) {
-					bind_data.is_index_scan = true;
-					get.function = TableScanFunction::GetIndexScanFunction();
-					return true;
-				}
-
-				bind_data.row_ids.clear();
-				return true;
-			}
-		}
-		return false;
+		return TryIndexScan(context, get, bind_data, transaction, art_index, filters);
+	});
+	if (bind_data.is_index_scan) {
+		return;
+	}
+	info->GetIndexes().BindAndScan<HashIndex>(context, *info, [&](HashIndex &hash_index) {
+		return TryIndexScan(context, get, bind_data, transaction, hash_index, filters);
 	});
 }
 
@@ -72,6 +72,8 @@ enum class BitpackingMode : uint8_t;
 
 enum class BlockState : uint8_t;
 
+enum class BufferEvictionPolicy : uint8_t;
+
 enum class CAPIResultSetType : uint8_t;
 
 enum class CSVState : uint8_t;
@@ -316,6 +318,8 @@ enum class TaskExecutionMode : uint8_t;
 
 enum class TaskExecutionResult : uint8_t;
 
+enum class TemporaryCompression : uint8_t;
+
 enum class TimestampCastResult : uint8_t;
 
 enum class TransactionModifierType : uint8_t;
@@ -407,6 +411,9 @@ const char* EnumUtil::ToChars<BitpackingMode>(BitpackingMode value);
 template<>
 const char* EnumUtil::ToChars<BlockState>(BlockState value);
 
+template<>
+const char* EnumUtil::ToChars<BufferEvictionPolicy>(BufferEvictionPolicy value);
+
 template<>
 const char* EnumUtil::ToChars<CAPIResultSetType>(CAPIResultSetType value);
 
@@ -773,6 +780,9 @@ const char* EnumUtil::ToChars<TaskExecutionMode>(TaskExecutionMode value);
 template<>
 const char* EnumUtil::ToChars<TaskExecutionResult>(TaskExecutionResult value);
 
+template<>
+const char* EnumUtil::ToChars<TemporaryCompression>(TemporaryCompression value);
+
 template<>
 const char* EnumUtil::ToChars<TimestampCastResult>(TimestampCastResult value);
 
@@ -879,6 +889,9 @@ BitpackingMode EnumUtil::FromString<BitpackingMode>(const char *value);
 template<>
 BlockState EnumUtil::FromString<BlockState>(const char *value);
 
+template<>
+BufferEvictionPolicy EnumUtil::FromString<BufferEvictionPolicy>(const char *value);
+
 template<>
 CAPIResultSetType EnumUtil::FromString<CAPIResultSetType>(const char *value);
 
@@ -1245,6 +1258,9 @@ TaskExecutionMode EnumUtil::FromString<TaskExecutionMode>(const char *value);
 template<>
 TaskExecutionResult EnumUtil::FromString<TaskExecutionResult>(const char *value);
 
+template<>
+TemporaryCompression EnumUtil::FromString<TemporaryCompression>(const char *value);
+
 template<>
 TimestampCastResult EnumUtil::FromString<TimestampCastResult>(const char *value);
 
@@ -0,0 +1,23 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/enums/buffer_eviction_policy.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/constants.hpp"
+
+namespace duckdb {
+
+//! The policy the buffer pool uses to select blocks for eviction
+enum class BufferEvictionPolicy : uint8_t {
+	//! Evict the least recently unpinned blocks first
+	LRU = 0,
+	//! Blocks that are referenced once are evicted before blocks that are referenced repeatedly (2Q)
+	TWO_QUEUE = 1
+};
+
+} // namespace duckdb
@@ -98,6 +98,20 @@ public:
 	string path;
 };
 
+//! A single read of a batch of reads issued through FileSystem::ReadBatch
+struct FileReadRequest {
+	FileReadRequest(void *buffer, int64_t nr_bytes, idx_t location)
+	    : buffer(buffer), nr_bytes(nr_bytes), location(location) {
+	}
+
+	//! The buffer to read into
+	void *buffer;
+	//! The amount of bytes to read
+	int64_t nr_bytes;
+	//! The location in the file to read from
+	idx_t location;
+};
+
 class FileSystem {
 public:
 	DUCKDB_API virtual ~FileSystem();
@@ -113,6 +127,9 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	DUCKDB_API virtual void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
+	//! Read a batch of (possibly scattered) ranges from a file. Fails if any of the reads could not be completed. File
+	//! systems that support asynchronous I/O submit all reads at once, by default the reads are issued one by one.
+	DUCKDB_API virtual void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests);
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	DUCKDB_API virtual void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location);
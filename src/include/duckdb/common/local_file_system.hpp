@@ -21,6 +21,9 @@ public:
 	//! Read exactly nr_bytes from the specified location in the file. Fails if nr_bytes could not be read. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Read().
 	void Read(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
+	//! Read a batch of ranges from the file. On Linux the reads are submitted together through io_uring when it is
+	//! available, otherwise they are issued one by one.
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override;
 	//! Write exactly nr_bytes to the specified location in the file. Fails if nr_bytes could not be written. This is
 	//! equivalent to calling SetFilePointer(location) followed by calling Write().
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override;
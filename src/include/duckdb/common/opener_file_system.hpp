@@ -34,6 +34,10 @@ public:
 		GetFileSystem().Read(handle, buffer, nr_bytes, location);
 	};
 
+	void ReadBatch(FileHandle &handle, vector<FileReadRequest> &requests) override {
+		GetFileSystem().ReadBatch(handle, requests);
+	}
+
 	void Write(FileHandle &handle, void *buffer, int64_t nr_bytes, idx_t location) override {
 		GetFileSystem().Write(handle, buffer, nr_bytes, location);
 	}
@@ -150,6 +150,9 @@ public:
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count);
 	//! Slice the vector, keeping the result around in a cache or potentially using the cache instead of slicing
 	DUCKDB_API void Slice(const SelectionVector &sel, idx_t count, SelCache &cache);
+	//! Creates a dictionary vector that references the first "dictionary_size" entries of the flat vector "dict".
+	//! Knowing the size of the dictionary allows operators to work on the distinct entries instead of on every row.
+	DUCKDB_API void Dictionary(const Vector &dict, idx_t dictionary_size, const SelectionVector &sel, idx_t count);
 
 	//! Creates the data of this vector with the specified type. Any data that
 	//! is currently in the vector is destroyed.
@@ -326,6 +329,11 @@ struct DictionaryVector {
 		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
 		return vector.auxiliary->Cast<VectorChildBuffer>().data;
 	}
+	//! The number of entries in the child vector, if known
+	static inline optional_idx DictionarySize(const Vector &vector) {
+		D_ASSERT(vector.GetVectorType() == VectorType::DICTIONARY_VECTOR);
+		return vector.buffer->Cast<DictionaryBuffer>().GetDictionarySize();
+	}
 };
 
 struct FlatVector {
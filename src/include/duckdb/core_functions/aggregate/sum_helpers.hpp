@@ -77,6 +77,20 @@ struct HugeintAdd {
 	}
 };
 
+struct RegularSubtract {
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+};
+
+struct HugeintSubtract {
+	template <class STATE, class T>
+	static void SubtractNumber(STATE &state, T input) {
+		state.value = Hugeint::Subtract(state.value, input);
+	}
+};
+
 struct KahanAdd {
 	template <class STATE, class T>
 	static void AddNumber(STATE &state, T input) {
@@ -172,4 +186,26 @@ struct BaseSumOperation {
 	}
 };
 
+//! The inverse of BaseSumOperation: removes values from the sum again. Only exact (integer) sums can be inverted
+template <class STATEOP, class SUBOP>
+struct BaseSumRemoveOperation {
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void Operation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &) {
+		STATEOP::template RemoveValues<STATE>(state, 1);
+		SUBOP::template SubtractNumber<STATE, INPUT_TYPE>(state, input);
+	}
+
+	template <class INPUT_TYPE, class STATE, class OP>
+	static void ConstantOperation(STATE &state, const INPUT_TYPE &input, AggregateUnaryInput &, idx_t count) {
+		STATEOP::template RemoveValues<STATE>(state, count);
+		for (idx_t i = 0; i < count; i++) {
+			SUBOP::template SubtractNumber<STATE, INPUT_TYPE>(state, input);
+		}
+	}
+
+	static bool IgnoreNull() {
+		return true;
+	}
+};
+
 } // namespace duckdb
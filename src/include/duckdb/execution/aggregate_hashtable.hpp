@@ -89,6 +89,9 @@ public:
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
 	void InitializePartitionedData();
+	//! Whether every row is appended as a new group without probing the pointer table (pre-aggregation bypass)
+	void SetSkipLookups(bool skip_lookups);
+	bool SkipLookups() const;
 
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
@@ -120,6 +123,8 @@ private:
 
 	//! The number of radix bits to partition by
 	idx_t radix_bits;
+	//! Whether to skip lookups, i.e., append every row as its own group, leaving aggregation to whoever combines
+	bool skip_lookups;
 	//! The data of the HT
 	unique_ptr<PartitionedTupleData> partitioned_data;
 
@@ -53,6 +53,12 @@ public:
 	//! True, if the ART owns its data
 	bool owns_data;
 
+	//! Try to initialize a scan on the index with the given (rewritten) index expressions and filters. Equality and IN
+	//! filters on the leading key columns, and prefix filters (e.g., LIKE 'abc%'), result in point lookups or prefix
+	//! scans. For a single key column, we also try range scans
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
 	//! Try to initialize a scan on the index with the given expression and filter
 	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction, const Expression &index_expr,
 	                                             const Expression &filter_expr);
@@ -83,8 +89,8 @@ public:
 	//! Insert a chunk of entries into the index
 	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_identifiers) override;
 
-	//! Construct an ART from a vector of sorted keys
-	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
+	//! Construct an ART bottom-up from the sorted keys [start, start + count), and their row IDs
+	bool ConstructFromSorted(vector<ARTKey> &keys, const row_t *row_ids, const idx_t start, const idx_t count);
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
@@ -101,15 +107,14 @@ public:
 
 	//! Returns the in-memory usage of the index. The lock obtained from InitializeLock must be held
 	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Unpins all buffers of the ART, so that the buffer manager can evict them under memory pressure. Must only be
+	//! called when no references to nodes are held
+	void UnpinBuffers();
 
 	//! Generate ART keys for an input chunk
 	template <bool IS_NOT_NULL = false>
 	static void GenerateKeys(ArenaAllocator &allocator, DataChunk &input, vector<ARTKey> &keys);
 
-	//! Generate a string containing all the expressions and their respective values that violate a constraint
-	string GenerateErrorKeyName(DataChunk &input, idx_t row);
-	//! Generate the matching error message for a constraint violation
-	string GenerateConstraintErrorMessage(VerifyExistenceType verify_type, const string &key_name);
 	//! Performs constraint checking for a chunk of input data
 	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
 
@@ -118,6 +123,9 @@ public:
 
 	//! Find the node with a matching key, or return nullptr if not found
 	optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Finds the leaves of the first count keys (or nullptr, if not found). The keys are looked up in sorted order,
+	//! so that each lookup resumes at the deepest node on the path of the previous key that shares its key prefix
+	void LookupBatch(const vector<ARTKey> &keys, const idx_t count, vector<optional_ptr<const Node>> &leaves);
 	//! Insert a key into the tree
 	bool Insert(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
@@ -127,6 +135,8 @@ private:
 	//! Erase a key from the tree (if a leaf has more than one value) or erase the leaf itself
 	void Erase(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
+	//! Returns all row IDs belonging to a key starting with the prefix
+	bool SearchPrefix(ARTKey &prefix, idx_t max_count, vector<row_t> &result_ids);
 	//! Returns all row IDs belonging to a key greater (or equal) than the search key
 	bool SearchGreater(ARTIndexScanState &state, ARTKey &key, bool equal, idx_t max_count, vector<row_t> &result_ids);
 	//! Returns all row IDs belonging to a key less (or equal) than the upper_bound
@@ -64,7 +64,7 @@ public:
 	//! Finds the minimum (leaf) of the current subtree
 	void FindMinimum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
-	//! bound exceeds the maximum value of the ART
+	//! bound exceeds the maximum value of the ART. The key can also be a prefix of the keys in the ART
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
 
 private:
@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/bloom_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/index_type.hpp"
+
+namespace duckdb {
+
+//! The Bloom filter index does not hold any data itself: it marks the columns for which every row group keeps a Bloom
+//! filter of its values (see BloomFilter), so that point lookups can skip the row groups that do not contain the key.
+//! The filters are built when the index is created, and are (re-)built and persisted when the table is checkpointed.
+class BloomIndex : public BoundIndex {
+public:
+	// Index type name for the Bloom filter index
+	static constexpr const char *TYPE_NAME = "BLOOM";
+	//! The storage compatibility (serialization) version that is required to read the persisted Bloom filters
+	static constexpr const idx_t SERIALIZATION_VERSION = 2;
+
+public:
+	BloomIndex(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+	           TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+	           AttachedDatabase &db);
+
+public:
+	//! Create a index instance of this type
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		return make_uniq<BloomIndex>(input.name, input.constraint_type, input.column_ids, input.table_io_manager,
+		                             input.unbound_expressions, input.db);
+	}
+
+	//! The row group Bloom filters are maintained by the row groups - appends, deletes and inserts are no-ops
+	ErrorData Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	void VerifyAppend(DataChunk &chunk) override;
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+	void CommitDrop(IndexLock &index_lock) override;
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	ErrorData Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) override;
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	void Vacuum(IndexLock &state) override;
+	//! Returns the size of the Bloom filters of the indexed columns, as of their last build or checkpoint
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	void SetInMemorySize(idx_t filter_size) {
+		in_memory_size = filter_size;
+	}
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+
+	//! The index has no storage of its own: only its name is serialized
+	IndexStorageInfo GetStorageInfo(const bool get_buffers) override;
+
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+
+private:
+	//! The size in bytes of the Bloom filters of the indexed columns
+	atomic<idx_t> in_memory_size;
+};
+
+} // namespace duckdb
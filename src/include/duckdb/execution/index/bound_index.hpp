@@ -117,10 +117,20 @@ public: // Index interface
 	//! Returns all index storage information for serialization
 	virtual IndexStorageInfo GetStorageInfo(const bool get_buffers);
 
+	//! Returns true, if the filter is an equality comparison or an IN list of constants on the index expression,
+	//! and adds the (non-NULL) constants
+	static bool GetEqualityConstants(const Expression &index_expr, const Expression &filter_expr, PhysicalType type,
+	                                 vector<Value> &constants);
+
 	//! Execute the index expressions on an input chunk
 	void ExecuteExpressions(DataChunk &input, DataChunk &result);
 	static string AppendRowError(DataChunk &input, idx_t index);
 
+	//! Generate a string containing all the expressions and their respective values that violate a constraint
+	string GenerateErrorKeyName(DataChunk &input, idx_t row);
+	//! Generate the matching error message for a constraint violation
+	string GenerateConstraintErrorMessage(VerifyExistenceType verify_type, const string &key_name);
+
 	//! Throw a constraint violation exception
 	virtual string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
 	                                             DataChunk &input) = 0;
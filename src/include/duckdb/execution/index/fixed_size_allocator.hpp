@@ -51,6 +51,15 @@ public:
 	//! Resets the allocator, e.g., during 'DELETE FROM table'
 	void Reset();
 
+	//! Unpins all buffers that were pinned since the last call, so that the buffer manager can evict them under
+	//! memory pressure. All pointers to segments obtained before are invalidated
+	void Unpin();
+	//! If set, read-only accesses (dirty = false) pin on-disk buffers directly instead of loading them into memory.
+	//! Must only be set while no segments are modified, and the buffers must be unpinned before resetting it
+	void SetReadOnly(const bool read_only_p) {
+		read_only = read_only_p;
+	}
+
 	//! Returns the in-memory size in bytes
 	idx_t GetInMemorySize() const;
 
@@ -107,16 +116,28 @@ private:
 	unordered_set<idx_t> buffers_with_free_space;
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
+	//! Buffers that were (possibly) pinned since the last call to Unpin
+	vector<idx_t> pinned_buffers;
+	//! True, if read-only accesses pin on-disk buffers directly
+	bool read_only;
 
 private:
 	//! Returns the data_ptr_t to a segment, and sets the dirty flag of the buffer containing that segment
 	inline data_ptr_t Get(const IndexPointer ptr, const bool dirty = true) {
 		D_ASSERT(ptr.GetOffset() < available_segments_per_buffer);
-		D_ASSERT(buffers.find(ptr.GetBufferId()) != buffers.end());
-		auto &buffer = buffers.find(ptr.GetBufferId())->second;
-		auto buffer_ptr = buffer.Get(dirty);
+		auto &buffer = GetBuffer(ptr.GetBufferId());
+		auto buffer_ptr = buffer.Get(dirty, read_only);
 		return buffer_ptr + ptr.GetOffset() * segment_size + bitmask_offset;
 	}
+	//! Returns the buffer with the given buffer id, which is about to be pinned
+	inline FixedSizeBuffer &GetBuffer(const idx_t buffer_id) {
+		D_ASSERT(buffers.find(buffer_id) != buffers.end());
+		auto &buffer = buffers.find(buffer_id)->second;
+		if (!buffer.IsPinned()) {
+			pinned_buffers.push_back(buffer_id);
+		}
+		return buffer;
+	}
 	//! Returns an available buffer id
 	idx_t GetAvailableBufferId() const;
 };
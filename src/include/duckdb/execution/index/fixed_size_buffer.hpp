@@ -32,7 +32,8 @@ public:
 
 //! A fixed-size buffer holds fixed-size segments of data. It lazily deserializes a buffer, if on-disk and not
 //! yet in memory, and it only serializes dirty and non-written buffers to disk during
-//! serialization.
+//! serialization. Read-only accesses can pin the on-disk block directly. Buffers are only pinned while they are
+//! accessed, so the buffer manager can evict them (or spill them to a temporary file) under memory pressure.
 class FixedSizeBuffer {
 public:
 	//! Constants for fast offset calculations in the bitmask
@@ -63,31 +64,42 @@ public:
 	BlockPointer block_pointer;
 
 public:
-	//! Returns true, if the buffer is in-memory
+	//! Returns true, if the buffer has an in-memory copy, i.e., if it is new or was loaded from disk
 	inline bool InMemory() const {
-		return buffer_handle.IsValid();
+		return !OnDisk();
 	}
 	//! Returns true, if the block is on-disk
 	inline bool OnDisk() const {
 		return block_pointer.IsValid();
 	}
-	//! Returns a pointer to the buffer in memory, and calls Deserialize, if the buffer is not in memory
-	inline data_ptr_t Get(const bool dirty_p = true) {
-		if (!InMemory()) {
+	//! Returns true, if the buffer is pinned
+	inline bool IsPinned() const {
+		return buffer_handle.IsValid();
+	}
+	//! Returns a pointer to the buffer. If the buffer is on disk, it is loaded into a new in-memory buffer, unless
+	//! the access is read-only, in which case the on-disk block is pinned directly
+	inline data_ptr_t Get(const bool dirty_p = true, const bool read_only = false) {
+		if (OnDisk() && (dirty_p || !read_only)) {
+			Load();
+		} else if (!IsPinned()) {
 			Pin();
 		}
 		if (dirty_p) {
 			dirty = dirty_p;
 		}
-		return buffer_handle.Ptr();
+		return buffer_handle.Ptr() + (OnDisk() ? block_pointer.offset : 0);
 	}
 	//! Destroys the in-memory buffer and the on-disk block
 	void Destroy();
 	//! Serializes a buffer (if dirty or not on disk)
 	void Serialize(PartialBlockManager &partial_block_manager, const idx_t available_segments, const idx_t segment_size,
 	               const idx_t bitmask_offset);
-	//! Pin a buffer (if not in-memory)
+	//! Pin the buffer, or the block containing the buffer, if the buffer is on disk
 	void Pin();
+	//! Unpin the buffer. Any pointers into the buffer are invalidated
+	void Unpin();
+	//! Load an on-disk buffer into a new in-memory buffer
+	void Load();
 	//! Returns the first free offset in a bitmask
 	uint32_t GetOffset(const idx_t bitmask_count);
 	//! Sets the allocation size, if dirty
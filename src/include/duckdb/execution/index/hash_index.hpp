@@ -0,0 +1,142 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/index/hash_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/index/bound_index.hpp"
+#include "duckdb/execution/index/fixed_size_allocator.hpp"
+#include "duckdb/execution/index/index_pointer.hpp"
+#include "duckdb/execution/index/index_type.hpp"
+
+namespace duckdb {
+
+class DataTable;
+class Transaction;
+
+//! The hash index answers equality lookups on a single key column of a fixed-size type (e.g., a UUID) with a single
+//! bucket access, and can enforce UNIQUE constraints (including ON CONFLICT checks).
+//! The keys are hashed into a directory of 2^n bucket chains, which doubles once the buckets fill up. The buckets
+//! are fixed-size segments of a FixedSizeAllocator, i.e., they are buffer-managed and persisted like the ART nodes.
+//! The directory is kept in memory, and is written to a chain of directory segments when serializing the index.
+class HashIndex : public BoundIndex {
+public:
+	// Index type name for the hash index
+	static constexpr const char *TYPE_NAME = "HASH";
+	//! The storage compatibility (serialization) version that is required to read hash indexes
+	static constexpr const idx_t SERIALIZATION_VERSION = 2;
+	//! The number of entries of a bucket segment
+	static constexpr uint8_t BUCKET_CAPACITY = 8;
+	//! The number of bucket chains of an empty index
+	static constexpr idx_t INITIAL_DIRECTORY_SIZE = 16;
+	//! The number of allocators of the hash index: one for the buckets and one for the serialized directory
+	static constexpr uint8_t ALLOCATOR_COUNT = 2;
+	//! The version of the hash function (VectorOperations::Hash) of the stored hashes. It has to be bumped whenever
+	//! the hash function changes, so that the hashes of an index written with another version are recomputed
+	static constexpr idx_t HASH_VERSION = 1;
+
+public:
+	HashIndex(const string &name, const IndexConstraintType index_constraint_type, const vector<column_t> &column_ids,
+	          TableIOManager &table_io_manager, const vector<unique_ptr<Expression>> &unbound_expressions,
+	          AttachedDatabase &db, const IndexStorageInfo &info = IndexStorageInfo());
+
+	//! Allocator of the bucket segments
+	unique_ptr<FixedSizeAllocator> bucket_allocator;
+	//! Allocator of the directory segments, which are only used to serialize the directory
+	unique_ptr<FixedSizeAllocator> directory_allocator;
+
+public:
+	//! Create a index instance of this type
+	static unique_ptr<BoundIndex> Create(CreateIndexInput &input) {
+		auto hash_index = make_uniq<HashIndex>(input.name, input.constraint_type, input.column_ids,
+		                                       input.table_io_manager, input.unbound_expressions, input.db,
+		                                       input.storage_info);
+		return std::move(hash_index);
+	}
+
+	//! Returns true, if a hash index can be created on a key of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+	//! Try to initialize a scan on the index with the given filters: equality and IN filters on the key
+	unique_ptr<IndexScanState> TryInitializeScan(const Transaction &transaction,
+	                                             const vector<unique_ptr<Expression>> &index_exprs,
+	                                             const vector<unique_ptr<Expression>> &filter_exprs);
+	//! Performs the point lookups of an index scan, and appends the matching row IDs to the result IDs. Returns false,
+	//! if the lookups match more than max_count rows
+	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, const idx_t max_count,
+	          vector<row_t> &result_ids);
+
+	//! Called when data is appended to the index. The lock obtained from InitializeLock must be held
+	ErrorData Append(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! Verify that data can be appended to the index without a constraint violation
+	void VerifyAppend(DataChunk &chunk) override;
+	//! Verify that data can be appended to the index without a constraint violation using the conflict manager
+	void VerifyAppend(DataChunk &chunk, ConflictManager &conflict_manager) override;
+	//! Probes the keys of a chunk in a batch: all keys are hashed at once, and each key accesses a single bucket chain
+	void CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_manager) override;
+
+	//! Deletes all data from the index. The lock obtained from InitializeLock must be held
+	void CommitDrop(IndexLock &index_lock) override;
+	//! Delete a chunk of entries from the index. The lock obtained from InitializeLock must be held
+	void Delete(IndexLock &lock, DataChunk &entries, Vector &row_identifiers) override;
+	//! Insert a chunk of entries into the index
+	ErrorData Insert(IndexLock &lock, DataChunk &input, Vector &row_identifiers) override;
+
+	//! Merge another hash index into this index by inserting all of its entries
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	//! Moves the bucket segments out of sparsely populated buffers
+	void Vacuum(IndexLock &state) override;
+	//! Returns the in-memory usage of the index
+	idx_t GetInMemorySize(IndexLock &index_lock) override;
+	//! Returns the string representation of the index, or only verifies the entry count
+	string VerifyAndToString(IndexLock &state, const bool only_verify) override;
+
+	//! Returns all hash index storage information for serialization
+	IndexStorageInfo GetStorageInfo(const bool get_buffers) override;
+
+	string GetConstraintViolationMessage(VerifyExistenceType verify_type, idx_t failed_index,
+	                                     DataChunk &input) override;
+
+	//! Unpins all buffers, so that the buffer manager can evict them
+	void UnpinBuffers();
+
+private:
+	//! The heads of the bucket chains. The size of the directory is a power of two
+	vector<IndexPointer> directory;
+	//! The number of entries in the index
+	idx_t entry_count = 0;
+
+private:
+	//! Computes the hashes and the (zero-padded) keys of the first count values of the input vector.
+	//! Sets valid[i] to false for NULL values
+	void GenerateKeys(Vector &input, idx_t count, vector<hash_t> &hashes, vector<uhugeint_t> &keys,
+	                  vector<bool> &valid) const;
+	//! Returns the bucket chain of a hash
+	IndexPointer &GetChain(const hash_t hash) {
+		return directory[hash & (directory.size() - 1)];
+	}
+	//! Returns the row ID of the first entry with the key, or false, if the key does not exist
+	bool Lookup(const hash_t hash, const uhugeint_t &key, row_t &row_id);
+	//! Appends the row IDs of all entries with the key. Returns false, if there are more than max_count row IDs
+	bool SearchEqual(const hash_t hash, const uhugeint_t &key, const idx_t max_count, vector<row_t> &row_ids);
+	//! Adds an entry to its bucket chain, without checking for constraint violations
+	void InsertEntry(const hash_t hash, const uhugeint_t &key, const row_t row_id);
+	//! Removes an entry from its bucket chain
+	void Erase(const hash_t hash, const uhugeint_t &key, const row_t row_id);
+	//! Doubles the directory and splits each bucket chain
+	void Grow();
+	//! Recomputes the hashes of all entries and rebuilds the bucket chains
+	void Rehash();
+	//! Writes the directory into the directory segments, and returns the first directory segment
+	IndexPointer SerializeDirectory();
+	//! Reads the directory from the directory segments
+	void DeserializeDirectory(IndexPointer root);
+	//! Serializes the segments of all allocators to disk
+	void WritePartialBlocks();
+};
+
+} // namespace duckdb
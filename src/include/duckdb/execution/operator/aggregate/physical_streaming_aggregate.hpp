@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/aggregate/physical_streaming_aggregate.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalStreamingAggregate computes a grouped aggregate over input that is sorted on the groups. Because all rows of
+//! a group arrive consecutively, a group is emitted as soon as the next group starts, without a hash table
+class PhysicalStreamingAggregate : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_GROUP_BY;
+
+public:
+	PhysicalStreamingAggregate(vector<LogicalType> types, vector<unique_ptr<Expression>> aggregates,
+	                           vector<unique_ptr<Expression>> groups, idx_t estimated_cardinality);
+
+	//! The groups
+	vector<unique_ptr<Expression>> groups;
+	//! The aggregates that have to be computed
+	vector<unique_ptr<Expression>> aggregates;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	OperatorFinalizeResultType FinalExecute(ExecutionContext &context, DataChunk &chunk, GlobalOperatorState &gstate,
+	                                        OperatorState &state) const final;
+
+	bool RequiresFinalExecute() const final {
+		return true;
+	}
+
+	OrderPreservationType OperatorOrder() const override {
+		return OrderPreservationType::FIXED_ORDER;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
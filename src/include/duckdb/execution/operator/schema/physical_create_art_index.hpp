@@ -23,6 +23,8 @@ class DuckTableEntry;
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+	//! The number of sorted keys that a thread buffers before constructing an ART from them
+	static constexpr const idx_t SORTED_KEY_BUFFER_SIZE = Storage::ROW_GROUP_SIZE * 8;
 
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
@@ -56,8 +58,10 @@ public:
 
 	//! Sink for unsorted data: insert iteratively
 	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
+	//! Sink for sorted data: buffer the keys, and build + merge
 	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
+	//! Constructs an ART bottom-up from each sorted run of the buffered keys, and merges it into the local index
+	void ConstructFromSortedKeys(LocalSinkState &l_state) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
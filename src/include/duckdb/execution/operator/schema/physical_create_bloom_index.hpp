@@ -0,0 +1,44 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/schema/physical_create_bloom_index.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/parser/parsed_data/create_index_info.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! Physical CREATE INDEX ... USING BLOOM statement
+class PhysicalCreateBloomIndex : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+
+public:
+	PhysicalCreateBloomIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
+	                         unique_ptr<CreateIndexInfo> info, vector<unique_ptr<Expression>> unbound_expressions,
+	                         idx_t estimated_cardinality);
+
+	//! The table to create the index for
+	DuckTableEntry &table;
+	//! The list of column IDs required for the index
+	vector<column_t> storage_ids;
+	//! Info for index creation
+	unique_ptr<CreateIndexInfo> info;
+	//! Unbound expressions of the index
+	vector<unique_ptr<Expression>> unbound_expressions;
+
+public:
+	//! Source interface: creates the index and builds the Bloom filters of the existing row groups
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+};
+} // namespace duckdb
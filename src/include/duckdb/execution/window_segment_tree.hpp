@@ -112,6 +112,24 @@ public:
 	              Vector &result, idx_t count, idx_t row_idx) const override;
 };
 
+//! Slides a running aggregate state along frames that only ever move forward (ROWS frames with constant offsets):
+//! for each row, the rows that entered the frame are added and the rows that left the frame are removed again.
+//! Requires aggregates with a remove function.
+class WindowSlidingAggregator : public WindowAggregator {
+public:
+	WindowSlidingAggregator(AggregateObject aggr, const vector<LogicalType> &arg_types_p,
+	                        const LogicalType &result_type_p, const WindowExcludeMode exclude_mode);
+	~WindowSlidingAggregator() override;
+
+	unique_ptr<WindowAggregatorState> GetGlobalState(idx_t group_count,
+	                                                 const ValidityMask &partition_mask) const override;
+	void Finalize(WindowAggregatorState &gsink, const FrameStats &stats) override;
+
+	unique_ptr<WindowAggregatorState> GetLocalState() const override;
+	void Evaluate(const WindowAggregatorState &gsink, WindowAggregatorState &lstate, const DataChunk &bounds,
+	              Vector &result, idx_t count, idx_t row_idx) const override;
+};
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
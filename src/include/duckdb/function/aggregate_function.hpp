@@ -48,6 +48,9 @@ typedef void (*aggregate_initialize_t)(data_ptr_t state);
 //! The type used for updating hashed aggregate functions
 typedef void (*aggregate_update_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
                                    Vector &state, idx_t count);
+//! The type used for removing values from hashed aggregate states, i.e. the inverse of the update (optional)
+typedef void (*aggregate_remove_t)(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                   Vector &state, idx_t count);
 //! The type used for combining hashed aggregate states
 typedef void (*aggregate_combine_t)(Vector &state, Vector &combined, AggregateInputData &aggr_input_data, idx_t count);
 //! The type used for finalizing hashed aggregate function payloads
@@ -149,6 +152,8 @@ public:
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
 	aggregate_wininit_t window_init = nullptr;
+	//! The inverse of the update function, used for incrementally sliding window frames (may be null)
+	aggregate_remove_t remove = nullptr;
 
 	//! The bind function (may be null)
 	bind_aggregate_function_t bind;
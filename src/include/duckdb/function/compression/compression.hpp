@@ -63,4 +63,17 @@ struct FSSTFun {
 	static bool TypeIsSupported(const CompressionInfo &info);
 };
 
+struct PForDeltaFun {
+	//! The storage compatibility (serialization) version that is required to read PFOR-Delta segments
+	static constexpr const idx_t SERIALIZATION_VERSION = 2;
+
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const CompressionInfo &info);
+};
+
+struct ZSTDFun {
+	static CompressionFunction GetFunction(PhysicalType type);
+	static bool TypeIsSupported(const CompressionInfo &info);
+};
+
 } // namespace duckdb
@@ -28,6 +28,7 @@ struct ColumnFetchState;
 struct ColumnScanState;
 struct PrefetchState;
 struct SegmentScanState;
+class TableFilter;
 
 class CompressionInfo {
 public:
@@ -175,6 +176,15 @@ typedef void (*compression_fetch_row_t)(ColumnSegment &segment, ColumnFetchState
 //! Function prototype used for skipping 'skip_count' values, non-trivial if random-access is not supported for the
 //! compressed data.
 typedef void (*compression_skip_t)(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count);
+//! Function prototype used for evaluating a filter on the compressed data of an entire vector (optional). The filter is
+//! evaluated on the 'sel_count' rows in 'sel', which is then narrowed down to the rows that pass the filter. Only the
+//! values of the rows that pass the filter have to be written to 'result'. NULL values are handled by the caller.
+typedef void (*compression_filter_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
+//! Function prototype used for scanning only the 'sel_count' rows in 'sel' out of the next 'vector_count' rows of the
+//! segment (optional). The values are written densely to the start of 'result'.
+typedef void (*compression_select_t)(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                     Vector &result, const SelectionVector &sel, idx_t sel_count);
 
 //===--------------------------------------------------------------------===//
 // Append (optional)
@@ -262,6 +272,12 @@ public:
 	compression_fetch_row_t fetch_row;
 	//! Skip forward in the compressed segment
 	compression_skip_t skip;
+	//! Evaluate a filter directly on the compressed data (optional)
+	//! if this is not set, the vector is scanned and the filter is evaluated on the decompressed data
+	compression_filter_t filter = nullptr;
+	//! Scan only the selected rows of an entire vector (optional)
+	//! if this is not set, the vector is scanned entirely and sliced afterwards
+	compression_select_t select = nullptr;
 
 	// Append functions
 	//! This only really needs to be defined for uncompressed segments
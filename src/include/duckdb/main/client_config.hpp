@@ -79,6 +79,13 @@ struct ClientConfig {
 	bool force_external = false;
 	//! Force disable cross product generation when hyper graph isn't connected, used for testing
 	bool force_no_cross_product = false;
+	//! The number of join pairs the exact join order enumerator considers before switching to a heuristic
+	idx_t join_order_enumeration_budget = 10000;
+	//! Whether or not the join orders found for large join graphs are cached
+	bool enable_join_order_cache = true;
+	//! The factor by which the build side of a hash join must exceed its estimate (and the estimated probe side) before
+	//! the probe is deferred and the join may be flipped at run-time (0 to disable)
+	idx_t adaptive_join_threshold = 16;
 	//! Force use of IEJoin to implement AsOfJoin, used for testing
 	bool force_asof_iejoin = false;
 	//! Force use of fetch row instead of scan, used for testing
@@ -104,6 +111,10 @@ struct ClientConfig {
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! The maximum amount of memory that the operators of the queries of this connection can reserve together through
+	//! the TemporaryMemoryManager, i.e., it caps the reservations of spilling operators. It does not limit the other
+	//! buffer allocations of the connection (e.g. base table blocks, or result collections). Default: unlimited
+	idx_t connection_operator_memory_limit = DConstants::INVALID_INDEX;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -12,6 +12,7 @@
 #include "duckdb/common/case_insensitive_map.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/enums/access_mode.hpp"
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/enums/compression_type.hpp"
 #include "duckdb/common/enums/optimizer_type.hpp"
 #include "duckdb/common/enums/order_type.hpp"
@@ -58,6 +59,16 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+//! How blocks that are written to the temporary directory are compressed
+enum class TemporaryCompression : uint8_t {
+	//! Write blocks as-is
+	NONE = 0,
+	//! Compress every block with LZ4
+	LZ4 = 1,
+	//! Compress a sample of every block first, and only compress blocks that compress well
+	ADAPTIVE = 2
+};
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -121,6 +132,8 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! The time (in microseconds) a committing transaction waits for other commits before syncing the WAL
+	idx_t wal_commit_delay = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -154,11 +167,19 @@ struct DBConfigOptions {
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! How blocks that are written to the temporary directory are compressed
+	TemporaryCompression temp_file_compression = TemporaryCompression::NONE;
+	//! Whether or not to submit batched block reads of the database file through io_uring (Linux only)
+	bool enable_io_uring = false;
+	//! Whether or not parallel scans of the database file prefetch the blocks of the row groups ahead of them
+	bool enable_scan_prefetch = true;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool buffer_manager_track_eviction_timestamps = false;
+	//! The policy the buffer pool uses to select blocks for eviction
+	BufferEvictionPolicy buffer_eviction_policy = BufferEvictionPolicy::LRU;
 	//! Whether or not to allow printing unredacted secrets
 	bool allow_unredacted_secrets = false;
 	//! The collation type of the database
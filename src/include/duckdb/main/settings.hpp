@@ -72,6 +72,16 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALCommitDelaySetting {
+	static constexpr const char *Name = "wal_commit_delay";
+	static constexpr const char *Description = "The time (in microseconds) a committing transaction waits for other "
+	                                           "transactions to commit, so their WAL entries can be synced together";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DebugCheckpointAbort {
 	static constexpr const char *Name = "debug_checkpoint_abort";
 	static constexpr const char *Description =
@@ -102,6 +112,37 @@ struct DebugForceNoCrossProduct {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct JoinOrderEnumerationBudget {
+	static constexpr const char *Name = "join_order_enumeration_budget"; // NOLINT
+	static constexpr const char *Description =                           // NOLINT
+	    "The number of join pairs the exact join order enumerator considers before switching to a heuristic";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableJoinOrderCache {
+	static constexpr const char *Name = "enable_join_order_cache"; // NOLINT
+	static constexpr const char *Description =                     // NOLINT
+	    "Whether or not the join orders found for large join graphs are cached and re-used";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AdaptiveJoinThreshold {
+	static constexpr const char *Name = "adaptive_join_threshold"; // NOLINT
+	static constexpr const char *Description =                     // NOLINT
+	    "The factor by which the build side of a hash join must exceed its estimate before the join may be flipped at "
+	    "run-time (0 to disable)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::UBIGINT; // NOLINT
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct OrderedAggregateThreshold {
 	static constexpr const char *Name = "ordered_aggregate_threshold"; // NOLINT
 	static constexpr const char *Description =                         // NOLINT
@@ -320,6 +361,26 @@ struct EnableObjectCacheSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableScanPrefetchSetting {
+	static constexpr const char *Name = "enable_scan_prefetch";
+	static constexpr const char *Description =
+	    "Whether or not parallel table scans prefetch the blocks of the row groups ahead of the row group they scan";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct EnableIOUringSetting {
+	static constexpr const char *Name = "enable_io_uring";
+	static constexpr const char *Description =
+	    "Whether or not to submit batched reads of the database file through io_uring, if supported by the system";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::BOOLEAN;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StorageCompatibilityVersion {
 	static constexpr const char *Name = "storage_compatibility_version";
 	static constexpr const char *Description = "Serialize on checkpoint with compatibility for a given duckdb version";
@@ -518,6 +579,17 @@ struct MaximumMemorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BufferEvictionPolicySetting {
+	static constexpr const char *Name = "buffer_eviction_policy";
+	static constexpr const char *Description =
+	    "The policy used to select blocks for eviction: lru, or the scan-resistant 2q policy that protects blocks "
+	    "which are referenced repeatedly";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct StreamingBufferSize {
 	static constexpr const char *Name = "streaming_buffer_size";
 	static constexpr const char *Description =
@@ -528,6 +600,17 @@ struct StreamingBufferSize {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct ConnectionOperatorMemoryLimitSetting {
+	static constexpr const char *Name = "connection_operator_memory_limit";
+	static constexpr const char *Description =
+	    "The maximum memory that the operators of the queries of this connection can reserve for their intermediates "
+	    "(e.g. 1GB). Other buffer allocations of the connection are not counted against it";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct MaximumTempDirectorySize {
 	static constexpr const char *Name = "max_temp_directory_size";
 	static constexpr const char *Description =
@@ -763,6 +846,16 @@ struct TempDirectorySetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct TempFileCompressionSetting {
+	static constexpr const char *Name = "temp_file_compression";
+	static constexpr const char *Description =
+	    "How blocks written to the temp directory are compressed (none, lz4 or adaptive)";
+	static constexpr const LogicalTypeId InputType = LogicalTypeId::VARCHAR;
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct ThreadsSetting {
 	static constexpr const char *Name = "threads";
 	static constexpr const char *Description = "The number of total threads used by the system.";
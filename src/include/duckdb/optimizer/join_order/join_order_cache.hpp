@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/join_order_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/deque.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+namespace duckdb {
+
+//! A single join in a cached join order: the relations on the left and right side of the join
+struct CachedJoinStep {
+	vector<idx_t> left;
+	vector<idx_t> right;
+};
+
+//! A cached join order is the (post-order) sequence of joins that produces the final plan
+using CachedJoinOrder = vector<CachedJoinStep>;
+
+//! The algorithm that found a cached join order
+enum class JoinOrderSolver : uint8_t { LINEARIZED, GREEDY };
+
+//! The JoinOrderCache stores the join orders found for large join graphs, keyed on a normalized representation of the
+//! query graph and the (bucketed) cardinalities of its relations. Repeated queries over the same join graph can then
+//! skip the (expensive) join order enumeration.
+class JoinOrderCache : public ObjectCacheEntry {
+public:
+	//! The maximum amount of join orders kept in the cache
+	static constexpr const idx_t MAXIMUM_ENTRIES = 1024;
+
+public:
+	~JoinOrderCache() override = default;
+
+	static JoinOrderCache &Get(ClientContext &context);
+
+	//! Look up the join order for a given key, returns false if there is none
+	bool TryGetJoinOrder(const string &key, CachedJoinOrder &result);
+	//! Store the join order for a given key, evicting the oldest entry if the cache is full
+	void StoreJoinOrder(const string &key, CachedJoinOrder join_order, JoinOrderSolver solver);
+
+	//! The amount of cached join orders that were found by the given algorithm
+	idx_t EntryCount(JoinOrderSolver solver);
+	//! The amount of lookups that found a cached join order
+	idx_t HitCount();
+
+	static string ObjectType() {
+		return "JOIN_ORDER_CACHE";
+	}
+
+	string GetObjectType() override {
+		return ObjectType();
+	}
+
+private:
+	struct CachedJoinOrderEntry {
+		CachedJoinOrder join_order;
+		JoinOrderSolver solver;
+	};
+
+	mutex lock;
+	//! The cached join orders
+	unordered_map<string, CachedJoinOrderEntry> join_orders;
+	//! The keys in insertion order, used for eviction
+	deque<string> insertion_order;
+	//! The amount of lookups that found a cached join order
+	idx_t hits = 0;
+};
+
+} // namespace duckdb
@@ -15,6 +15,7 @@
 #include "duckdb/optimizer/join_order/query_graph.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/cost_model.hpp"
+#include "duckdb/optimizer/join_order/join_order_cache.hpp"
 #include "duckdb/parser/expression_map.hpp"
 #include "duckdb/common/reference_map.hpp"
 #include "duckdb/planner/logical_operator.hpp"
@@ -75,8 +76,20 @@ private:
 	//! Solve the join order exactly using dynamic programming. Returns true if it was completed successfully (i.e. did
 	//! not time-out)
 	bool SolveJoinOrderExactly();
+	//! Solve the join order using dynamic programming over the sub-chains of a linearization of the join graph. Returns
+	//! true if a full plan was found (i.e. the join graph is connected)
+	bool SolveJoinOrderLinearized();
 	//! Solve the join order approximately using a greedy algorithm
 	void SolveJoinOrderApproximately();
+
+	//! Compute the key under which the join order of this query graph is cached
+	string ComputeJoinOrderCacheKey();
+	//! Re-create the plans of a cached join order. Returns true if the full plan could be re-created
+	bool TryReplayJoinOrder(const CachedJoinOrder &join_order);
+	//! Whether the cached join order can be replayed on the current query graph
+	bool ValidateJoinOrder(const CachedJoinOrder &join_order);
+	//! Extract the sequence of joins that produces the plan for the given set
+	void ExtractJoinOrder(JoinRelationSet &set, CachedJoinOrder &join_order);
 };
 
 } // namespace duckdb
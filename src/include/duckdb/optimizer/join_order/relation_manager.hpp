@@ -60,6 +60,9 @@ public:
 	vector<unique_ptr<SingleJoinRelation>> GetRelations();
 
 	const vector<RelationStats> GetRelationStats();
+	//! Identifies a relation across queries: the fully qualified name of a scanned table, or the operator type and a
+	//! structural hash of the plan of any other relation
+	string GetRelationCacheKey(idx_t relation_index);
 	//! A mapping of base table index -> index into relations array (relation number)
 	unordered_map<idx_t, idx_t> relation_mapping;
 
@@ -22,6 +22,17 @@ class ClientContext;
 class DatabaseInstance;
 class MetadataManager;
 
+//! A run of adjacent blocks that is read into a single buffer
+struct BlockReadRun {
+	BlockReadRun(FileBuffer &buffer, block_id_t start_block, idx_t block_count)
+	    : buffer(buffer), start_block(start_block), block_count(block_count) {
+	}
+
+	reference<FileBuffer> buffer;
+	block_id_t start_block;
+	idx_t block_count;
+};
+
 //! BlockManager is an abstract representation to manage blocks on DuckDB. When writing or reading blocks, the
 //! BlockManager creates and accesses blocks. The concrete types implement specific block storage strategies.
 class BlockManager {
@@ -56,6 +67,12 @@ public:
 	virtual void Read(Block &block) = 0;
 	//! Read the content of the block from disk
 	virtual void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) = 0;
+	//! Read several runs of blocks from disk. By default the runs are read one by one.
+	virtual void ReadBlockRuns(vector<BlockReadRun> &runs);
+	//! Whether or not ReadBlockRuns submits the reads of all runs together
+	virtual bool SupportsBatchedReads() {
+		return false;
+	}
 	//! Writes the block to disk
 	virtual void Write(FileBuffer &block, block_id_t block_id) = 0;
 	//! Writes the block to disk
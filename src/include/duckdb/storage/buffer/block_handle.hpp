@@ -129,6 +129,10 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! The eviction clock of the buffer pool when this block was last unpinned (for the 2Q eviction policy)
+	atomic<idx_t> last_unpin_clock;
+	//! Whether or not the latest eviction queue node of this block is in a protected queue (for the 2Q policy)
+	atomic<bool> eviction_protected;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/enums/buffer_eviction_policy.hpp"
 #include "duckdb/common/file_buffer.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/storage/buffer/block_handle.hpp"
@@ -55,6 +56,10 @@ public:
 
 	TemporaryMemoryManager &GetTemporaryMemoryManager();
 
+	//! Set the policy that is used to select blocks for eviction
+	void SetEvictionPolicy(BufferEvictionPolicy policy);
+	BufferEvictionPolicy GetEvictionPolicy() const;
+
 protected:
 	//! Evict blocks until the currently used memory + extra_memory fit, returns false if this was not possible
 	//! (i.e. not enough blocks could be evicted)
@@ -79,10 +84,13 @@ protected:
 	//! Add a buffer handle to the eviction queue. Returns true, if the queue is
 	//! ready to be purged, and false otherwise.
 	bool AddToEvictionQueue(shared_ptr<BlockHandle> &handle);
-	//! Gets the eviction queue for the specified type
-	EvictionQueue &GetEvictionQueueForType(FileBufferType type);
-	//! Increments the dead nodes for the queue with specified type
-	void IncrementDeadNodes(FileBufferType type);
+	//! Gets the eviction queue for the specified type. With the 2Q eviction policy, blocks that are referenced
+	//! repeatedly are placed in a separate, protected queue, which is only evicted from after the regular queue.
+	EvictionQueue &GetEvictionQueueForType(FileBufferType type, bool is_protected = false);
+	//! Increments the dead nodes for the queue that holds the latest eviction node of the block
+	void IncrementDeadNodes(BlockHandle &handle);
+	//! Whether or not an unpinned block should be placed in the protected queue (2Q eviction policy)
+	bool ShouldProtect(BlockHandle &handle);
 
 protected:
 	//! The lock for changing the memory limit
@@ -93,12 +101,20 @@ protected:
 	atomic<idx_t> maximum_memory;
 	//! Record timestamps of buffer manager unpin() events. Usable by custom eviction policies.
 	bool track_eviction_timestamps;
-	//! Eviction queues
+	//! Eviction queues: one regular and one protected queue per buffer type
 	vector<unique_ptr<EvictionQueue>> queues;
+	//! The eviction policy
+	atomic<BufferEvictionPolicy> eviction_policy;
+	//! Counts the blocks that are added to the eviction queues, used to measure the distance between references
+	atomic<idx_t> eviction_clock;
 	//! Memory manager for concurrently used temporary memory, e.g., for physical operators
 	unique_ptr<TemporaryMemoryManager> temporary_memory_manager;
 	//! Memory usage per tag
 	atomic<idx_t> memory_usage_per_tag[MEMORY_TAG_COUNT];
+	//! The amount of blocks that were evicted per tag
+	atomic<idx_t> evicted_blocks_per_tag[MEMORY_TAG_COUNT];
+	//! The amount of blocks that were moved to a protected eviction queue per tag
+	atomic<idx_t> protected_blocks_per_tag[MEMORY_TAG_COUNT];
 };
 
 } // namespace duckdb
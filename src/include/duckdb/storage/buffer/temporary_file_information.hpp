@@ -9,11 +9,17 @@ struct MemoryInformation {
 	MemoryTag tag;
 	idx_t size;
 	idx_t evicted_data;
+	idx_t evicted_blocks;
+	idx_t protected_blocks;
 };
 
 struct TemporaryFileInformation {
 	string path;
 	idx_t size;
+	//! The size in which blocks are stored in the file (smaller than the block size if they are compressed)
+	idx_t block_size;
+	//! The number of bytes saved by compressing the blocks that are currently in the file
+	idx_t bytes_saved;
 };
 
 } // namespace duckdb
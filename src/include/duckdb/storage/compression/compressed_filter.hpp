@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/compression/compressed_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+
+namespace duckdb {
+
+//! Helpers for evaluating table filters directly on compressed segments
+struct CompressedFilter {
+	//! Whether a filter can be evaluated on the compressed data of a segment. The validity of a column is stored
+	//! separately: IS NULL filters cannot be, and IS NOT NULL filters pass for every value, as the caller removes the
+	//! NULL rows afterwards.
+	static bool CanFilter(const TableFilter &filter);
+	//! Evaluates a filter on the 'count' values in 'values' (e.g. the entries of a dictionary or the values of
+	//! runs). Sets matches[i] for every value that passes the filter.
+	static void FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches);
+	//! Narrows down 'sel' to the rows for which matches[row] is set
+	static void SelectMatches(const bool *matches, SelectionVector &sel, idx_t &sel_count);
+};
+
+//! Evaluates a filter on a vector that is made up of ranges of rows with known bounds, such as the groups of a bitpacked
+//! segment. Ranges that cannot pass the filter do not have to be decompressed, and rows in ranges that always pass the
+//! filter do not have to be compared.
+class CompressedRangeFilter {
+public:
+	CompressedRangeFilter(const TableFilter &filter, const LogicalType &type);
+
+	//! Checks the filter against the bounds of a range of values
+	template <class T>
+	FilterPropagateResult CheckBounds(T min, T max) {
+		auto stats = NumericStats::CreateEmpty(type);
+		NumericStats::Update<T>(stats, min);
+		NumericStats::Update<T>(stats, max);
+		// checking the statistics does not modify the filter
+		return const_cast<TableFilter &>(filter).CheckStatistics(stats);
+	}
+	//! Registers the result of the filter for the rows [start, end) of the vector
+	void SetRange(idx_t start, idx_t end, FilterPropagateResult result);
+	//! Narrows down 'sel' to the rows that pass the filter. Rows of ranges for which the result could not be
+	//! determined up front are compared against the (decompressed) values in 'result'.
+	void Select(Vector &result, idx_t vector_count, SelectionVector &sel, idx_t &sel_count);
+
+private:
+	const TableFilter &filter;
+	LogicalType type;
+	FilterPropagateResult row_results[STANDARD_VECTOR_SIZE];
+};
+
+} // namespace duckdb
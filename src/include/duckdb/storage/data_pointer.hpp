@@ -64,6 +64,8 @@ struct RowGroupPointer {
 	vector<MetaBlockPointer> data_pointers;
 	//! Data pointers to the delete information of the row group (if any)
 	vector<MetaBlockPointer> deletes_pointers;
+	//! Data pointers to the Bloom filters of the columns of the row group (if any)
+	vector<MetaBlockPointer> bloom_filter_pointers;
 };
 
 } // namespace duckdb
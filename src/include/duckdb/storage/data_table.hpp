@@ -216,6 +216,8 @@ public:
 	void InitializeIndexes(ClientContext &context);
 	bool HasIndexes() const;
 	void AddIndex(unique_ptr<Index> index);
+	//! Builds the Bloom filters of the given columns for all row groups of the table, and returns their size in bytes
+	idx_t BuildBloomFilters(const vector<column_t> &column_ids);
 	bool HasForeignKeyIndex(const vector<PhysicalIndex> &keys, ForeignKeyType type);
 	void SetIndexStorageInfo(vector<IndexStorageInfo> index_storage_info);
 	void VacuumIndexes();
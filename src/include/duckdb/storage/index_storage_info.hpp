@@ -56,6 +56,8 @@ struct IndexStorageInfo {
 
 	//! The root block pointer of the index, which is necessary to support older storage files
 	BlockPointer root_block_ptr;
+	//! The version of the hash function of the hashes that are stored in the index (zero, if it stores none)
+	idx_t hash_version = 0;
 
 	//! Returns true, if the struct contains index information
 	bool IsValid() const {
@@ -65,6 +65,9 @@ public:
 	void Read(Block &block) override;
 	//! Read the content of a range of blocks into a buffer
 	void ReadBlocks(FileBuffer &buffer, block_id_t start_block, idx_t block_count) override;
+	//! Read several runs of blocks, submitting all reads together if batched reads are enabled
+	void ReadBlockRuns(vector<BlockReadRun> &runs) override;
+	bool SupportsBatchedReads() override;
 	//! Write the given block to disk
 	void Write(FileBuffer &block, block_id_t block_id) override;
 	//! Write the header to disk, this is the final step of the checkpointing process
@@ -83,6 +86,8 @@ public:
 	bool IsRemote() override;
 
 private:
+	//! Verifies the checksums of a range of blocks that was read into the buffer
+	void VerifyBlockChecksums(FileBuffer &buffer, idx_t location, idx_t block_count);
 	//! Loads the free list of the file.
 	void LoadFreeList();
 	//! Initializes the database header. We pass the provided block allocation size as a parameter
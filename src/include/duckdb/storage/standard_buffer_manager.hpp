@@ -34,6 +34,10 @@ class StandardBufferManager : public BufferManager {
 	friend class BlockHandle;
 	friend class BlockManager;
 
+public:
+	//! The maximum amount of blocks that BatchReadRuns reads into intermediate buffers at once
+	static constexpr const idx_t BATCH_READ_MAXIMUM_BLOCKS = 64;
+
 public:
 	StandardBufferManager(DatabaseInstance &db, string temp_directory);
 	~StandardBufferManager() override;
@@ -145,6 +149,13 @@ protected:
 
 	void BatchRead(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
 	               block_id_t first_block, block_id_t last_block);
+	//! Reads the runs of adjacent blocks in batches of at most BATCH_READ_MAXIMUM_BLOCKS blocks (or a single larger
+	//! run), for block managers that support batched reads
+	void BatchReadRuns(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                   const vector<pair<block_id_t, block_id_t>> &runs);
+	//! Loads the blocks of a run that was read into an intermediate buffer
+	void LoadBlocksFromBuffer(vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                          block_id_t first_block, idx_t block_count, BufferHandle &intermediate_buffer);
 
 protected:
 	// These are stored here because temp_directory creation is lazy
@@ -0,0 +1,85 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/storage/statistics/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/enums/filter_propagate_result.hpp"
+#include "duckdb/common/types/value.hpp"
+#include "duckdb/common/unique_ptr.hpp"
+
+namespace duckdb {
+class Vector;
+class Serializer;
+class Deserializer;
+class TableFilter;
+
+//! A Bloom filter over the values of a column of a row group. Equality lookups on high-cardinality columns, for which
+//! the min/max statistics are useless, can skip the row groups that do not contain the value.
+//! The filter is register-blocked: every value sets four bits in a single 64-bit word, so a lookup touches one word.
+class BloomFilter {
+public:
+	//! The version of the hash function (VectorOperations::Hash) the filter bits are derived from. It has to be bumped
+	//! whenever the hash function changes: persisted filters of another version are ignored, as their bits no longer
+	//! match the hashes of the values.
+	static constexpr const idx_t HASH_VERSION = 1;
+
+public:
+	//! Creates an empty filter that is sized for the rows [0, row_count) of a row group
+	explicit BloomFilter(idx_t row_count);
+	BloomFilter(idx_t row_count, vector<uint64_t> words);
+
+public:
+	//! Adds the hashes of 'count' values to the filter
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Adds the 'count' values of the vector to the filter. NULL values are skipped.
+	void Insert(Vector &input, idx_t count);
+	//! Returns false if the value is definitely not part of the filter
+	bool MightContain(const Value &value) const;
+	//! Returns FILTER_ALWAYS_FALSE if none of the rows covered by the filter can pass the (equality) filter
+	FilterPropagateResult CheckFilter(const TableFilter &filter, const LogicalType &type) const;
+
+	//! The number of rows of the row group the filter was built for
+	idx_t GetRowCount() const {
+		return row_count;
+	}
+	idx_t GetSizeInBytes() const {
+		return words.size() * sizeof(uint64_t);
+	}
+
+	//! Whether or not a Bloom filter can be built for columns of the given type
+	static bool TypeIsSupported(const LogicalType &type);
+
+	void Serialize(Serializer &serializer) const;
+	//! Returns nullptr if the filter was written with a different hash version (see HASH_VERSION)
+	static unique_ptr<BloomFilter> Deserialize(Deserializer &deserializer);
+
+private:
+	//! The number of words of a filter for 'row_count' rows
+	static idx_t WordCount(idx_t row_count);
+	bool MightContainHash(hash_t hash) const {
+		auto word = words[hash & mask];
+		auto bits = GetBits(hash);
+		return (word & bits) == bits;
+	}
+	static uint64_t GetBits(hash_t hash) {
+		// the low bits of the hash select the word, the high bits select the bits within the word
+		return (1ULL << ((hash >> 40) & 63)) | (1ULL << ((hash >> 46) & 63)) | (1ULL << ((hash >> 52) & 63)) |
+		       (1ULL << ((hash >> 58) & 63));
+	}
+
+private:
+	//! The number of bits that are reserved for every row
+	static constexpr const idx_t BLOOM_FILTER_BITS_PER_VALUE = 10;
+
+	idx_t row_count;
+	vector<uint64_t> words;
+	hash_t mask;
+};
+
+} // namespace duckdb
@@ -33,8 +33,12 @@ public:
 
 	//! Revert the commit
 	virtual void RevertCommit() = 0;
-	// Make the commit persistent
+	// Write the commit to storage
 	virtual void FlushCommit() = 0;
+	//! Make the flushed commit persistent. This is called after the WAL lock has been released, so that concurrent
+	//! commits can be synced together
+	virtual void SyncCommit() {
+	}
 };
 
 struct CheckpointOptions {
@@ -112,6 +112,11 @@ public:
 	                        SelectionVector &sel, idx_t count);
 	virtual void FilterScanCommitted(idx_t vector_index, ColumnScanState &state, Vector &result, SelectionVector &sel,
 	                                 idx_t count, bool allow_updates);
+	//! Whether the selected rows of the next vector can be scanned directly from the current segment
+	bool CanSelectVector(ColumnScanState &state, idx_t target_count);
+	//! Scans only the selected rows of the next vector from the current segment (see CanSelectVector)
+	void SelectVector(ColumnScanState &state, Vector &result, idx_t target_count, const SelectionVector &sel,
+	                  idx_t sel_count);
 
 	//! Skip the scan forward by "count" rows
 	virtual void Skip(ColumnScanState &state, idx_t count = STANDARD_VECTOR_SIZE);
@@ -178,6 +183,12 @@ protected:
 	template <bool SCAN_COMMITTED, bool ALLOW_UPDATES>
 	idx_t ScanVector(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
 	                 idx_t target_scan);
+	//! Evaluates a filter directly on the compressed data of the next vector, if the current segment supports it.
+	//! Returns false without scanning anything if the vector has to be scanned and filtered regularly instead.
+	bool FilterVector(ColumnScanState &state, Vector &result, idx_t target_count, SelectionVector &sel,
+	                  idx_t &sel_count, const TableFilter &filter);
+	//! Initializes the scan of the current segment if required, and skips forward to the current row
+	void BeginScanVector(ColumnScanState &state);
 
 	void ClearUpdates();
 	void FetchUpdates(TransactionData transaction, idx_t vector_index, Vector &result, idx_t scan_count,
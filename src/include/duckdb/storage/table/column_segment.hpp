@@ -71,6 +71,16 @@ public:
 	void Scan(ColumnScanState &state, idx_t scan_count, Vector &result, idx_t result_offset, ScanVectorType scan_type);
 	//! Fetch a value of the specific row id and append it to the result
 	void FetchRow(ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx);
+	//! Whether or not filters can be evaluated directly on the compressed data of this segment
+	bool SupportsFilter() const;
+	//! Evaluate a filter on the compressed data of one vector from this segment, narrowing down the selection vector
+	void Filter(ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel, idx_t &sel_count,
+	            const TableFilter &filter);
+	//! Whether or not the compression function of this segment can scan only the selected rows of a vector
+	bool SupportsSelect() const;
+	//! Scan only the selected rows of one vector from this segment
+	void Select(ColumnScanState &state, idx_t vector_count, Vector &result, const SelectionVector &sel,
+	            idx_t sel_count);
 
 	static idx_t FilterSelection(SelectionVector &sel, Vector &vector, UnifiedVectorFormat &vdata,
 	                             const TableFilter &filter, idx_t scan_count, idx_t &approved_tuple_count);
@@ -42,7 +42,10 @@ class TableFilterSet;
 struct ColumnFetchState;
 struct RowGroupAppendState;
 class MetadataManager;
+class MetadataWriter;
 class RowVersionManager;
+struct PrefetchState;
+class BloomFilter;
 
 struct RowGroupWriteInfo {
 	RowGroupWriteInfo(PartialBlockManager &manager, const vector<CompressionType> &compression_types,
@@ -100,6 +103,9 @@ public:
 	//! Initialize a scan over this row_group
 	bool InitializeScan(CollectionScanState &state);
 	bool InitializeScanWithOffset(CollectionScanState &state, idx_t vector_offset);
+	//! Gathers the on-disk blocks that a scan over this row group will read. Returns false if the entire row group
+	//! can be skipped based on its zonemaps.
+	bool InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state);
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(TableFilterSet &filters, const vector<column_t> &column_ids);
@@ -151,6 +157,11 @@ public:
 
 	void GetColumnSegmentInfo(idx_t row_group_index, vector<ColumnSegmentInfo> &result);
 
+	//! Builds the Bloom filter of the column over all rows of the row group, unless it already has a valid one
+	void BuildBloomFilter(storage_t c);
+	//! Returns the size in bytes of the Bloom filter of the column that is loaded in memory (if any)
+	idx_t GetBloomFilterSize(storage_t c);
+
 	idx_t GetAllocationSize() const {
 		return allocation_size;
 	}
@@ -178,9 +189,24 @@ private:
 	void TemplatedScan(TransactionData transaction, CollectionScanState &state, DataChunk &result);
 
 	vector<MetaBlockPointer> CheckpointDeletes(MetadataManager &manager);
+	//! Whether or not the column was read from disk and has not been loaded since
+	bool IsColumnUnloaded(storage_t c) const;
+	//! Re-use the meta data of an unloaded column in a checkpoint
+	MetaBlockPointer ReuseColumnPointer(storage_t c);
 
 	bool HasUnloadedDeletes() const;
 
+	//! Returns the Bloom filter of the column, or nullptr if the column has no (valid) Bloom filter
+	shared_ptr<BloomFilter> GetBloomFilter(storage_t c);
+	//! Drops the Bloom filters of all columns - called whenever the data of the row group changes
+	void InvalidateBloomFilters();
+	//! Returns the columns of the table that have a Bloom filter index
+	vector<storage_t> GetBloomFilterColumns();
+	//! Reads a Bloom filter from the metadata, optionally collecting the metadata blocks it is stored in
+	shared_ptr<BloomFilter> ReadBloomFilter(MetaBlockPointer pointer,
+	                                        optional_ptr<vector<MetaBlockPointer>> read_pointers = nullptr);
+	vector<MetaBlockPointer> CheckpointBloomFilters(MetadataWriter &writer);
+
 private:
 	mutex row_group_lock;
 	vector<MetaBlockPointer> column_pointers;
@@ -188,6 +214,15 @@ private:
 	vector<MetaBlockPointer> deletes_pointers;
 	atomic<bool> deletes_is_loaded;
 	idx_t allocation_size;
+	//! Protects the Bloom filters
+	mutex bloom_filter_lock;
+	//! The Bloom filters of the columns (if any), and the metadata they are stored in on disk (if any)
+	vector<shared_ptr<BloomFilter>> bloom_filters;
+	vector<MetaBlockPointer> bloom_filter_pointers;
+	//! Whether or not any column has a Bloom filter, so scans and appends can skip the lock if there are none
+	atomic<bool> has_bloom_filters;
+	//! Incremented whenever the Bloom filters are invalidated, so concurrent builds do not install stale filters
+	idx_t bloom_filter_version;
 };
 
 } // namespace duckdb
@@ -33,6 +33,10 @@ struct VacuumState;
 struct CollectionCheckpointState;
 
 class RowGroupCollection {
+public:
+	//! The maximum amount of row groups that parallel scans prefetch ahead of the current row group
+	static constexpr const idx_t MAX_PREFETCH_DEPTH = 16;
+
 public:
 	RowGroupCollection(shared_ptr<DataTableInfo> info, BlockManager &block_manager, vector<LogicalType> types,
 	                   idx_t row_start, idx_t total_rows = 0);
@@ -95,6 +99,11 @@ public:
 	bool ScheduleVacuumTasks(CollectionCheckpointState &checkpoint_state, VacuumState &state, idx_t segment_idx);
 	void ScheduleCheckpointTask(CollectionCheckpointState &checkpoint_state, idx_t segment_idx);
 
+	//! Builds the Bloom filters of the given columns for all row groups, and returns their total size in bytes
+	idx_t BuildBloomFilters(const vector<column_t> &column_ids);
+	//! Sets the in-memory size of the Bloom filter indexes to the sizes of the Bloom filters of their columns
+	void SetBloomIndexSizes(const vector<idx_t> &column_filter_sizes);
+
 	void CommitDropColumn(idx_t index);
 	void CommitDropTable();
 
@@ -127,6 +136,16 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	//! Whether or not parallel scans prefetch the row groups ahead of them (see the enable_scan_prefetch setting)
+	bool ShouldPrefetch(ClientContext &context);
+	//! Determines which row groups ahead of the given row group should be prefetched
+	void PlanPrefetch(ParallelCollectionScanState &state, CollectionScanState &scan_state, RowGroup &row_group,
+	                  vector<reference<RowGroup>> &result);
+	//! Prefetches the blocks of the projected columns of the given row groups, and adapts the prefetch depth.
+	//! The prefetch is synchronous: it is issued by the thread that claims the row group, as one batched read, and
+	//! overlaps I/O with the scans of the other threads rather than with the compute of the claiming thread.
+	void PrefetchRowGroups(ParallelCollectionScanState &state, CollectionScanState &scan_state,
+	                       vector<reference<RowGroup>> &prefetch_row_groups);
 
 private:
 	//! BlockManager
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/map.hpp"
 #include "duckdb/storage/buffer/buffer_handle.hpp"
@@ -130,6 +131,10 @@ public:
 	idx_t batch_index;
 	//! The valid selection
 	SelectionVector valid_sel;
+	//! When this scan started on its current row group, used to estimate the time it takes to scan a row group
+	time_point<high_resolution_clock> row_group_scan_start;
+	//! Whether or not row_group_scan_start is set
+	bool row_group_scan_started = false;
 
 public:
 	void Initialize(const vector<LogicalType> &types);
@@ -190,6 +195,15 @@ struct ParallelCollectionScanState {
 	idx_t batch_index;
 	atomic<idx_t> processed_rows;
 	mutex lock;
+
+	//! The first row for which the blocks have not been prefetched yet
+	idx_t prefetch_row;
+	//! How many row groups ahead of the scan are prefetched. This is adapted to the ratio between the time it takes
+	//! to read a row group and the time it takes to scan it.
+	idx_t prefetch_depth;
+	//! Moving averages of the time (in microseconds) that reading and scanning a row group take
+	double row_group_read_time;
+	double row_group_scan_time;
 };
 
 struct ParallelTableScanState {
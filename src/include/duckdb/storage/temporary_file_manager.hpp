@@ -24,10 +24,11 @@ namespace duckdb {
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager;
+enum class TemporaryCompression : uint8_t;
 
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t block_size);
 	BlockIndexManager();
 
 public:
@@ -38,6 +39,7 @@ public:
 	bool RemoveIndex(idx_t index);
 	idx_t GetMaxIndex();
 	bool HasFreeBlocks();
+	idx_t GetUsedBlockCount();
 
 private:
 	void SetMaxIndex(idx_t blocks);
@@ -45,6 +47,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size of a block on disk
+	idx_t block_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -75,7 +79,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t slot_size, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -89,10 +93,14 @@ public:
 public:
 	TemporaryFileIndex TryGetBlockIndex();
 	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	void WriteTemporaryFile(const_data_ptr_t compressed_data, TemporaryFileIndex index);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
 	TemporaryFileInformation GetTemporaryFile();
+	idx_t GetSlotSize() const {
+		return slot_size;
+	}
 
 private:
 	void CreateFileIfNotExists(TemporaryFileLock &);
@@ -101,6 +109,8 @@ private:
 
 private:
 	const idx_t max_allowed_index;
+	//! The size of the slots in this file: blocks are stored compressed if this is smaller than the block size
+	const idx_t slot_size;
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
@@ -132,6 +142,10 @@ private:
 //===--------------------------------------------------------------------===//
 
 class TemporaryFileManager {
+public:
+	//! Compressed blocks are stored in slots that are a multiple of this size
+	static constexpr idx_t TEMPORARY_SLOT_ALIGNMENT = Storage::BLOCK_ALLOC_SIZE / 8;
+
 public:
 	TemporaryFileManager(DatabaseInstance &db, const string &temp_directory_p);
 	~TemporaryFileManager();
@@ -158,6 +172,12 @@ public:
 	//! Register temporary file size decrease
 	void DecreaseSizeOnDisk(idx_t amount);
 
+	//! Compresses a block into "compressed", returning the size of the slot to store it in. Returns the block size if
+	//! the block is not compressed
+	idx_t CompressBuffer(TemporaryCompression compression, FileBuffer &buffer, AllocatedData &compressed);
+	//! Decompresses a compressed slot into a block
+	static void DecompressBuffer(const_data_ptr_t compressed_data, FileBuffer &buffer);
+
 private:
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
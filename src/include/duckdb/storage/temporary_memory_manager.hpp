@@ -24,7 +24,8 @@ class TemporaryMemoryState {
 	friend class TemporaryMemoryManager;
 
 private:
-	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, idx_t minimum_reservation);
+	TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager, ClientContext &context,
+	                     idx_t minimum_reservation);
 
 public:
 	~TemporaryMemoryState();
@@ -42,6 +43,8 @@ public:
 private:
 	//! The TemporaryMemoryManager that owns this state
 	TemporaryMemoryManager &temporary_memory_manager;
+	//! The client that registered this state
+	ClientContext &context;
 
 	//! The remaining size needed if it could fit fully in memory
 	atomic<idx_t> remaining_size;
@@ -94,6 +97,15 @@ private:
 	void SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation);
 	//! Unregister a TemporaryMemoryState (called by the destructor of TemporaryMemoryState)
 	void Unregister(TemporaryMemoryState &temporary_memory_state);
+	//! Gets the memory limit that is configured for the client. A client executes one query at a time, so this is
+	//! also the limit of the query that the client is executing
+	static idx_t GetClientMemoryLimit(ClientContext &context);
+	//! Computes how much of the given client limit is not reserved by the other states of the client of the state
+	//! (must hold the lock)
+	idx_t GetClientFreeMemory(TemporaryMemoryState &temporary_memory_state, idx_t client_limit) const;
+	//! Computes the share of the memory limit that the client of the state can use, given the demand of the other
+	//! active clients (must hold the lock)
+	idx_t GetClientShare(TemporaryMemoryState &temporary_memory_state) const;
 	//! Verify internal counts (must hold the lock)
 	void Verify() const;
 
@@ -110,6 +122,15 @@ private:
 	//! Max memory per query
 	idx_t query_max_memory;
 
+	//! The combined reservation and remaining size of the active states of a client
+	struct ClientMemoryUsage {
+		idx_t reservation = 0;
+		idx_t remaining_size = 0;
+		idx_t state_count = 0;
+	};
+	//! The memory usage of the clients that have active states
+	reference_map_t<ClientContext, ClientMemoryUsage> client_usage;
+
 	//! Currently active states
 	reference_set_t<TemporaryMemoryState> active_states;
 	//! The sum of reservations of all active states
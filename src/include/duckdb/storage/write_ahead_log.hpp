@@ -14,12 +14,15 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -110,7 +113,14 @@ public:
 	void Truncate(idx_t size);
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
+	//! Write a flush marker and sync the WAL to disk
 	void Flush();
+	//! Write a flush marker and hand all pending entries to the file system, without syncing the file. Returns the
+	//! flush id that has to be passed to SyncFlush to make the entries durable
+	idx_t WriteFlush();
+	//! Wait until the entries written up to the given flush id are synced to disk. Concurrent committers are synced
+	//! together: the first waiting committer syncs the WAL on behalf of all others that have written their entries
+	void SyncFlush(idx_t flush_id);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -120,6 +130,17 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<bool> initialized;
+
+	//! Protects the group commit state below
+	mutex sync_lock;
+	//! Signalled whenever a sync of the WAL finishes
+	std::condition_variable sync_cv;
+	//! The id of the last flush that was handed to the file system
+	idx_t written_flush_id = 0;
+	//! The id of the last flush that is known to be synced to disk
+	idx_t synced_flush_id = 0;
+	//! Whether or not a committer is currently syncing the WAL
+	bool sync_in_progress = false;
 };
 
 } // namespace duckdb
@@ -43,11 +43,16 @@ public:
 	void SetReadWrite() override;
 
 	bool ShouldWriteToWAL(AttachedDatabase &db);
+	//! Write the changes of this transaction to the WAL and mark them as committed. The WAL entries are written but
+	//! not yet synced: the caller has to call SyncCommit on the commit state before making the commit visible
 	ErrorData WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCommitState> &commit_state) noexcept;
+	//! Whether or not the transaction has appended data that has not been moved to the base tables yet
+	bool HasLocalChanges();
+	//! Move the transaction-local appends to the base tables, without writing them to the WAL
+	ErrorData FlushLocalStorage() noexcept;
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
-	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id,
-	                 unique_ptr<StorageCommitState> commit_state) noexcept;
+	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id) noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
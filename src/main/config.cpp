@@ -58,10 +58,14 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllowPersistentSecrets),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_GLOBAL(WALCommitDelaySetting),
     DUCKDB_GLOBAL(DebugCheckpointAbort),
     DUCKDB_GLOBAL(StorageCompatibilityVersion),
     DUCKDB_LOCAL(DebugForceExternal),
     DUCKDB_LOCAL(DebugForceNoCrossProduct),
+    DUCKDB_LOCAL(JoinOrderEnumerationBudget),
+    DUCKDB_LOCAL(EnableJoinOrderCache),
+    DUCKDB_LOCAL(AdaptiveJoinThreshold),
     DUCKDB_LOCAL(DebugAsOfIEJoin),
     DUCKDB_LOCAL(PreferRangeJoins),
     DUCKDB_GLOBAL(DebugWindowMode),
@@ -82,6 +86,8 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(AutoloadKnownExtensions),
     DUCKDB_GLOBAL(EnableObjectCacheSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
+    DUCKDB_GLOBAL(EnableIOUringSetting),
+    DUCKDB_GLOBAL(EnableScanPrefetchSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
@@ -101,7 +107,9 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(IntegerDivisionSetting),
     DUCKDB_LOCAL(MaximumExpressionDepthSetting),
     DUCKDB_LOCAL(StreamingBufferSize),
+    DUCKDB_LOCAL(ConnectionOperatorMemoryLimitSetting),
     DUCKDB_GLOBAL(MaximumMemorySetting),
+    DUCKDB_GLOBAL(BufferEvictionPolicySetting),
     DUCKDB_GLOBAL(MaximumTempDirectorySize),
     DUCKDB_LOCAL(MergeJoinThreshold),
     DUCKDB_LOCAL(NestedLoopJoinThreshold),
@@ -125,6 +133,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(SecretDirectorySetting),
     DUCKDB_GLOBAL(DefaultSecretStorage),
     DUCKDB_GLOBAL(TempDirectorySetting),
+    DUCKDB_GLOBAL(TempFileCompressionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
     DUCKDB_GLOBAL(ExportLargeBufferArrow),
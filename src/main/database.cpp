@@ -250,13 +250,14 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 		ThrowExtensionSetUnrecognizedOptions(config.options.unrecognized_options);
 	}
 
+	// launch the threads before the main database is loaded, so that they can help with replaying its WAL
+	// they only execute the tasks that are scheduled on them, the storage is loaded by this thread
+	scheduler->SetThreads(config.options.maximum_threads, config.options.external_threads);
+	scheduler->RelaunchThreads();
+
 	if (!db_manager->HasDefaultDatabase()) {
 		CreateMainDatabase();
 	}
-
-	// only increase thread count after storage init because we get races on catalog otherwise
-	scheduler->SetThreads(config.options.maximum_threads, config.options.external_threads);
-	scheduler->RelaunchThreads();
 }
 
 DuckDB::DuckDB(const char *path, DBConfig *new_config) : instance(make_shared_ptr<DatabaseInstance>()) {
@@ -385,6 +386,7 @@ void DatabaseInstance::Configure(DBConfig &new_config, const char *database_path
 		config.buffer_pool = make_shared_ptr<BufferPool>(config.options.maximum_memory,
 		                                                 config.options.buffer_manager_track_eviction_timestamps);
 	}
+	config.buffer_pool->SetEvictionPolicy(config.options.buffer_eviction_policy);
 }
 
 DBConfig &DBConfig::GetConfig(ClientContext &context) {
@@ -13,6 +13,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/planner/expression_binder.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 
@@ -95,6 +96,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// WAL Commit Delay
+//===--------------------------------------------------------------------===//
+void WALCommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.wal_commit_delay = input.GetValue<uint64_t>();
+}
+
+void WALCommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.wal_commit_delay = DBConfig().options.wal_commit_delay;
+}
+
+Value WALCommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.wal_commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -165,6 +182,51 @@ Value DebugForceNoCrossProduct::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_no_cross_product);
 }
 
+//===--------------------------------------------------------------------===//
+// Join Order Enumeration Budget
+//===--------------------------------------------------------------------===//
+void JoinOrderEnumerationBudget::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).join_order_enumeration_budget = ClientConfig().join_order_enumeration_budget;
+}
+
+void JoinOrderEnumerationBudget::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).join_order_enumeration_budget = input.GetValue<uint64_t>();
+}
+
+Value JoinOrderEnumerationBudget::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).join_order_enumeration_budget);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable Join Order Cache
+//===--------------------------------------------------------------------===//
+void EnableJoinOrderCache::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).enable_join_order_cache = ClientConfig().enable_join_order_cache;
+}
+
+void EnableJoinOrderCache::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).enable_join_order_cache = input.GetValue<bool>();
+}
+
+Value EnableJoinOrderCache::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).enable_join_order_cache);
+}
+
+//===--------------------------------------------------------------------===//
+// Adaptive Join Threshold
+//===--------------------------------------------------------------------===//
+void AdaptiveJoinThreshold::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).adaptive_join_threshold = ClientConfig().adaptive_join_threshold;
+}
+
+void AdaptiveJoinThreshold::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).adaptive_join_threshold = input.GetValue<uint64_t>();
+}
+
+Value AdaptiveJoinThreshold::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).adaptive_join_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Ordered Aggregate Threshold
 //===--------------------------------------------------------------------===//
@@ -594,6 +656,38 @@ Value EnableObjectCacheSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.object_cache_enable);
 }
 
+//===--------------------------------------------------------------------===//
+// Enable Scan Prefetch
+//===--------------------------------------------------------------------===//
+void EnableScanPrefetchSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_scan_prefetch = input.GetValue<bool>();
+}
+
+void EnableScanPrefetchSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_scan_prefetch = DBConfig().options.enable_scan_prefetch;
+}
+
+Value EnableScanPrefetchSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_scan_prefetch);
+}
+
+//===--------------------------------------------------------------------===//
+// Enable IO Uring
+//===--------------------------------------------------------------------===//
+void EnableIOUringSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_io_uring = input.GetValue<bool>();
+}
+
+void EnableIOUringSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_io_uring = DBConfig().options.enable_io_uring;
+}
+
+Value EnableIOUringSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_io_uring);
+}
+
 //===--------------------------------------------------------------------===//
 // Storage Compatibility Version (for serialization)
 //===--------------------------------------------------------------------===//
@@ -1134,6 +1228,36 @@ Value MaximumMemorySetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.maximum_memory));
 }
 
+//===--------------------------------------------------------------------===//
+// Buffer Eviction Policy
+//===--------------------------------------------------------------------===//
+void BufferEvictionPolicySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto policy = StringUtil::Lower(input.ToString());
+	if (policy == "lru") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::LRU;
+	} else if (policy == "2q") {
+		config.options.buffer_eviction_policy = BufferEvictionPolicy::TWO_QUEUE;
+	} else {
+		throw InvalidInputException("Unrecognized option for buffer_eviction_policy \"%s\", expected lru or 2q",
+		                            policy);
+	}
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+void BufferEvictionPolicySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.buffer_eviction_policy = DBConfig().options.buffer_eviction_policy;
+	if (db) {
+		db->GetBufferPool().SetEvictionPolicy(config.options.buffer_eviction_policy);
+	}
+}
+
+Value BufferEvictionPolicySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return config.options.buffer_eviction_policy == BufferEvictionPolicy::LRU ? "lru" : "2q";
+}
+
 //===--------------------------------------------------------------------===//
 // Streaming Buffer Size
 //===--------------------------------------------------------------------===//
@@ -1152,6 +1276,28 @@ Value StreamingBufferSize::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.streaming_buffer_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Connection Memory Limit
+//===--------------------------------------------------------------------===//
+void ConnectionOperatorMemoryLimitSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.connection_operator_memory_limit = DBConfig::ParseMemoryLimit(input.ToString());
+}
+
+void ConnectionOperatorMemoryLimitSetting::ResetLocal(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.connection_operator_memory_limit = ClientConfig().connection_operator_memory_limit;
+}
+
+Value ConnectionOperatorMemoryLimitSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	if (config.connection_operator_memory_limit == DConstants::INVALID_INDEX) {
+		// no limit
+		return Value();
+	}
+	return Value(StringUtil::BytesToHumanReadableString(config.connection_operator_memory_limit));
+}
+
 //===--------------------------------------------------------------------===//
 // Maximum Temp Directory Size
 //===--------------------------------------------------------------------===//
@@ -1636,6 +1782,32 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto compression = StringUtil::Lower(input.ToString());
+	if (compression == "none") {
+		config.options.temp_file_compression = TemporaryCompression::NONE;
+	} else if (compression == "lz4") {
+		config.options.temp_file_compression = TemporaryCompression::LZ4;
+	} else if (compression == "adaptive") {
+		config.options.temp_file_compression = TemporaryCompression::ADAPTIVE;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized option for temp_file_compression \"%s\", expected none, lz4 or adaptive", compression);
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return StringUtil::Lower(EnumUtil::ToString(config.options.temp_file_compression));
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
@@ -0,0 +1,56 @@
+#include "duckdb/optimizer/join_order/join_order_cache.hpp"
+
+namespace duckdb {
+
+JoinOrderCache &JoinOrderCache::Get(ClientContext &context) {
+	auto &cache = ObjectCache::GetObjectCache(context);
+	return *cache.GetOrCreate<JoinOrderCache>(JoinOrderCache::ObjectType());
+}
+
+bool JoinOrderCache::TryGetJoinOrder(const string &key, CachedJoinOrder &result) {
+	lock_guard<mutex> guard(lock);
+	auto entry = join_orders.find(key);
+	if (entry == join_orders.end()) {
+		return false;
+	}
+	result = entry->second.join_order;
+	hits++;
+	return true;
+}
+
+void JoinOrderCache::StoreJoinOrder(const string &key, CachedJoinOrder join_order, JoinOrderSolver solver) {
+	lock_guard<mutex> guard(lock);
+	auto entry = join_orders.find(key);
+	if (entry != join_orders.end()) {
+		entry->second.join_order = std::move(join_order);
+		entry->second.solver = solver;
+		return;
+	}
+	while (join_orders.size() >= MAXIMUM_ENTRIES && !insertion_order.empty()) {
+		join_orders.erase(insertion_order.front());
+		insertion_order.pop_front();
+	}
+	CachedJoinOrderEntry new_entry;
+	new_entry.join_order = std::move(join_order);
+	new_entry.solver = solver;
+	join_orders.emplace(key, std::move(new_entry));
+	insertion_order.push_back(key);
+}
+
+idx_t JoinOrderCache::EntryCount(JoinOrderSolver solver) {
+	lock_guard<mutex> guard(lock);
+	idx_t count = 0;
+	for (auto &entry : join_orders) {
+		if (entry.second.solver == solver) {
+			count++;
+		}
+	}
+	return count;
+}
+
+idx_t JoinOrderCache::HitCount() {
+	lock_guard<mutex> guard(lock);
+	return hits;
+}
+
+} // namespace duckdb
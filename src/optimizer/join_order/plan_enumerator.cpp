@@ -1,5 +1,6 @@
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 
+#include "duckdb/common/optional_idx.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/query_graph_manager.hpp"
@@ -161,10 +162,8 @@ bool PlanEnumerator::TryEmitPair(JoinRelationSet &left, JoinRelationSet &right,
 	// If a full plan is created, it's possible a node in the plan gets updated. When this happens, make sure you keep
 	// emitting pairs until you emit another final plan. Another final plan is guaranteed to be produced because of
 	// our symmetry guarantees.
-	if (pairs >= 10000) {
-		// when the amount of pairs gets too large we exit the dynamic programming and resort to a greedy algorithm
-		// FIXME: simple heuristic currently
-		// at 10K pairs stop searching exactly and switch to heuristic
+	if (pairs >= query_graph_manager.context.config.join_order_enumeration_budget) {
+		// when the amount of pairs gets too large we exit the dynamic programming and resort to a heuristic
 		return false;
 	}
 	EmitPair(left, right, info);
@@ -328,6 +327,85 @@ bool PlanEnumerator::SolveJoinOrderExactly() {
 	return true;
 }
 
+bool PlanEnumerator::SolveJoinOrderLinearized() {
+	// the exact enumeration is exponential in the amount of relations, instead we fix a linear order of the relations
+	// and only consider the join trees whose leaves are consecutive in that order. This allows for dynamic programming
+	// over the O(n^2) sub-chains of the linear order in O(n^3). See "Adaptive Optimization of Very Large Join Queries"
+	// by Thomas Neumann and Bernhard Radke.
+	auto num_relations = query_graph_manager.relation_manager.NumRelations();
+	auto &set_manager = query_graph_manager.set_manager;
+
+	// we linearize the join graph in a greedy fashion: we start with the smallest relation, and then keep appending the
+	// connected relation that results in the smallest intermediate
+	idx_t start = 0;
+	for (idx_t i = 1; i < num_relations; i++) {
+		auto cardinality = plans[set_manager.GetJoinRelation(i)]->cardinality;
+		if (cardinality < plans[set_manager.GetJoinRelation(start)]->cardinality) {
+			start = i;
+		}
+	}
+	vector<idx_t> order;
+	unordered_set<idx_t> ordered_relations;
+	order.push_back(start);
+	ordered_relations.insert(start);
+	reference<JoinRelationSet> prefix = set_manager.GetJoinRelation(start);
+	while (order.size() < num_relations) {
+		optional_idx best_relation;
+		double best_cardinality = NumericLimits<double>::Maximum();
+		for (idx_t i = 0; i < num_relations; i++) {
+			if (ordered_relations.find(i) != ordered_relations.end()) {
+				continue;
+			}
+			auto &candidate = set_manager.GetJoinRelation(i);
+			if (query_graph.GetConnections(prefix, candidate).empty()) {
+				continue;
+			}
+			auto &new_set = set_manager.Union(prefix, candidate);
+			auto cardinality = cost_model.cardinality_estimator.EstimateCardinalityWithSet<double>(new_set);
+			if (!best_relation.IsValid() || cardinality < best_cardinality) {
+				best_relation = i;
+				best_cardinality = cardinality;
+			}
+		}
+		if (!best_relation.IsValid()) {
+			// the join graph is not connected: leave it to the greedy algorithm to add cross products
+			return false;
+		}
+		order.push_back(best_relation.GetIndex());
+		ordered_relations.insert(best_relation.GetIndex());
+		prefix = set_manager.Union(prefix, set_manager.GetJoinRelation(best_relation.GetIndex()));
+	}
+
+	// chains[i][j] holds the relation set containing the relations order[i]...order[j]
+	vector<vector<optional_ptr<JoinRelationSet>>> chains(num_relations);
+	for (idx_t i = 0; i < num_relations; i++) {
+		chains[i].resize(num_relations);
+		chains[i][i] = &set_manager.GetJoinRelation(order[i]);
+		for (idx_t j = i + 1; j < num_relations; j++) {
+			chains[i][j] = &set_manager.Union(*chains[i][j - 1], set_manager.GetJoinRelation(order[j]));
+		}
+	}
+	// now find the best plan for every sub-chain, starting from the smallest ones
+	for (idx_t length = 2; length <= num_relations; length++) {
+		for (idx_t i = 0; i + length <= num_relations; i++) {
+			auto j = i + length - 1;
+			for (idx_t split = i; split < j; split++) {
+				auto &left = *chains[i][split];
+				auto &right = *chains[split + 1][j];
+				if (plans.find(left) == plans.end() || plans.find(right) == plans.end()) {
+					continue;
+				}
+				auto connections = query_graph.GetConnections(left, right);
+				if (connections.empty()) {
+					continue;
+				}
+				EmitPair(left, right, connections);
+			}
+		}
+	}
+	return plans.find(*chains[0][num_relations - 1]) != plans.end();
+}
+
 void PlanEnumerator::SolveJoinOrderApproximately() {
 	// at this point, we exited the dynamic programming but did not compute the final join order because it took too
 	// long instead, we use a greedy heuristic to obtain a join ordering now we use Greedy Operator Ordering to
@@ -456,15 +534,156 @@ void PlanEnumerator::InitLeafPlans() {
 	}
 }
 
+static idx_t CardinalityBucket(idx_t cardinality) {
+	idx_t bucket = 0;
+	while (cardinality > 1) {
+		cardinality >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+string PlanEnumerator::ComputeJoinOrderCacheKey() {
+	// the key consists of the relations and the join filters between them
+	// the cardinalities are bucketed to powers of two: they act as the statistics epoch of the cached join order, so
+	// that the join order is re-optimized only if the statistics of one of the relations change significantly
+	// the relations are identified by their fully qualified name (or by the structure of their plan, if they are not
+	// base tables), so that same-named relations that are different do not share a join order
+	string key;
+	auto &relation_manager = query_graph_manager.relation_manager;
+	auto relation_stats = relation_manager.GetRelationStats();
+	for (idx_t i = 0; i < relation_stats.size(); i++) {
+		key += relation_manager.GetRelationCacheKey(i) + ":" +
+		       to_string(CardinalityBucket(relation_stats[i].cardinality)) + ";";
+	}
+	key += "|";
+	for (auto &filter_info : query_graph_manager.GetFilterBindings()) {
+		if (!filter_info->left_set || !filter_info->right_set) {
+			continue;
+		}
+		key += filter_info->left_set->ToString() + JoinTypeToString(filter_info->join_type) +
+		       filter_info->right_set->ToString();
+		if (filter_info->filter) {
+			key += filter_info->filter->ToString();
+		}
+		key += ";";
+	}
+	return key;
+}
+
+bool PlanEnumerator::ValidateJoinOrder(const CachedJoinOrder &join_order) {
+	// every step has to join two disjoint sets that are available at that point, i.e., single relations or the
+	// results of earlier steps, and in the end all relations have to be joined
+	bool force_no_cross_product = query_graph_manager.context.config.force_no_cross_product;
+	auto relation_count = query_graph_manager.relation_manager.NumRelations();
+	// the available set each relation is part of (identified by one of its relations), and the size of each set
+	vector<idx_t> relation_sets(relation_count);
+	vector<idx_t> set_sizes(relation_count, 1);
+	for (idx_t i = 0; i < relation_count; i++) {
+		relation_sets[i] = i;
+	}
+	auto is_available_set = [&](const vector<idx_t> &relations) {
+		if (relations.empty() || relations[0] >= relation_count) {
+			return false;
+		}
+		auto set = relation_sets[relations[0]];
+		for (idx_t i = 0; i < relations.size(); i++) {
+			if (relations[i] >= relation_count || (i > 0 && relations[i] <= relations[i - 1]) ||
+			    relation_sets[relations[i]] != set) {
+				return false;
+			}
+		}
+		return set_sizes[set] == relations.size();
+	};
+	auto &set_manager = query_graph_manager.set_manager;
+	for (auto &step : join_order) {
+		if (!is_available_set(step.left) || !is_available_set(step.right)) {
+			return false;
+		}
+		auto left_set = relation_sets[step.left[0]];
+		auto right_set = relation_sets[step.right[0]];
+		if (left_set == right_set) {
+			return false;
+		}
+		if (force_no_cross_product) {
+			auto &left = set_manager.GetJoinRelation(unordered_set<idx_t>(step.left.begin(), step.left.end()));
+			auto &right = set_manager.GetJoinRelation(unordered_set<idx_t>(step.right.begin(), step.right.end()));
+			if (query_graph.GetConnections(left, right).empty()) {
+				return false;
+			}
+		}
+		for (auto &relation : step.right) {
+			relation_sets[relation] = left_set;
+		}
+		set_sizes[left_set] += set_sizes[right_set];
+	}
+	return relation_count > 0 && set_sizes[relation_sets[0]] == relation_count;
+}
+
+bool PlanEnumerator::TryReplayJoinOrder(const CachedJoinOrder &join_order) {
+	// the join order is validated first, so that an invalid join order does not leave any plans or cross products
+	// behind for the join order optimization that follows
+	if (!ValidateJoinOrder(join_order)) {
+		return false;
+	}
+	auto &set_manager = query_graph_manager.set_manager;
+	for (auto &step : join_order) {
+		auto &left = set_manager.GetJoinRelation(unordered_set<idx_t>(step.left.begin(), step.left.end()));
+		auto &right = set_manager.GetJoinRelation(unordered_set<idx_t>(step.right.begin(), step.right.end()));
+		D_ASSERT(plans.find(left) != plans.end() && plans.find(right) != plans.end());
+		auto connections = query_graph.GetConnections(left, right);
+		if (connections.empty()) {
+			// the cached join order contains a cross product
+			query_graph_manager.CreateQueryGraphCrossProduct(left, right);
+			connections = query_graph.GetConnections(left, right);
+			D_ASSERT(!connections.empty());
+		}
+		EmitPair(left, right, connections);
+	}
+	return true;
+}
+
+void PlanEnumerator::ExtractJoinOrder(JoinRelationSet &set, CachedJoinOrder &join_order) {
+	auto entry = plans.find(set);
+	D_ASSERT(entry != plans.end());
+	auto &node = *entry->second;
+	if (node.is_leaf) {
+		return;
+	}
+	ExtractJoinOrder(node.left_set, join_order);
+	ExtractJoinOrder(node.right_set, join_order);
+	CachedJoinStep step;
+	step.left.assign(node.left_set.relations.get(), node.left_set.relations.get() + node.left_set.count);
+	step.right.assign(node.right_set.relations.get(), node.right_set.relations.get() + node.right_set.count);
+	join_order.push_back(std::move(step));
+}
+
 // the plan enumeration is a straight implementation of the paper "Dynamic Programming Strikes Back" by Guido
 // Moerkotte and Thomas Neumannn, see that paper for additional info/documentation bonus slides:
 // https://db.in.tum.de/teaching/ws1415/queryopt/chapter3.pdf?lang=de
 void PlanEnumerator::SolveJoinOrder() {
-	bool force_no_cross_product = query_graph_manager.context.config.force_no_cross_product;
+	auto &config = query_graph_manager.context.config;
+	bool force_no_cross_product = config.force_no_cross_product;
+	string cache_key;
+	if (config.enable_join_order_cache) {
+		// check if we have already optimized this join graph before
+		cache_key = ComputeJoinOrderCacheKey();
+		CachedJoinOrder join_order;
+		auto &cache = JoinOrderCache::Get(query_graph_manager.context);
+		if (cache.TryGetJoinOrder(cache_key, join_order) && TryReplayJoinOrder(join_order)) {
+			return;
+		}
+	}
 	// first try to solve the join order exactly
-	if (!SolveJoinOrderExactly()) {
-		// otherwise, if that times out we resort to a greedy algorithm
-		SolveJoinOrderApproximately();
+	bool solved_exactly = SolveJoinOrderExactly();
+	auto solver = JoinOrderSolver::LINEARIZED;
+	if (!solved_exactly) {
+		// if that exceeds the enumeration budget we resort to dynamic programming over a linearized join graph
+		if (!SolveJoinOrderLinearized()) {
+			// if the join graph cannot be linearized we resort to a greedy algorithm
+			SolveJoinOrderApproximately();
+			solver = JoinOrderSolver::GREEDY;
+		}
 	}
 
 	// now the optimal join path should have been found
@@ -487,6 +706,12 @@ void PlanEnumerator::SolveJoinOrder() {
 		//! solve the join order again, returning the final plan
 		return SolveJoinOrder();
 	}
+	if (config.enable_join_order_cache && !solved_exactly) {
+		// the join order was expensive to find: cache it
+		CachedJoinOrder join_order;
+		ExtractJoinOrder(total_relation, join_order);
+		JoinOrderCache::Get(query_graph_manager.context).StoreJoinOrder(cache_key, std::move(join_order), solver);
+	}
 }
 
 } // namespace duckdb
@@ -1,10 +1,15 @@
 #include "duckdb/optimizer/join_order/relation_manager.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/relation_statistics_helper.hpp"
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/parser/expression_map.hpp"
+#include "duckdb/parser/parsed_data/parse_info.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
 #include "duckdb/planner/expression/list.hpp"
 #include "duckdb/planner/operator/list.hpp"
@@ -19,6 +24,34 @@ const vector<RelationStats> RelationManager::GetRelationStats() {
 	return ret;
 }
 
+//! Hashes the operator types, parameters and expressions of a plan
+static hash_t StructuralHash(LogicalOperator &op) {
+	hash_t result = Hash(static_cast<uint8_t>(op.type));
+	result = CombineHash(result, Hash(op.ParamsToString().c_str()));
+	for (auto &expression : op.expressions) {
+		result = CombineHash(result, Hash(expression->ToString().c_str()));
+	}
+	for (auto &child : op.children) {
+		result = CombineHash(result, StructuralHash(*child));
+	}
+	return result;
+}
+
+string RelationManager::GetRelationCacheKey(idx_t relation_index) {
+	auto &relation = *relations[relation_index];
+	if (relation.op.type == LogicalOperatorType::LOGICAL_GET) {
+		auto table = relation.op.Cast<LogicalGet>().GetTable();
+		if (table) {
+			return ParseInfo::QualifierToString(table->ParentCatalog().GetName(), table->ParentSchema().name,
+			                                    table->name);
+		}
+	}
+	// other relations (e.g., subqueries, aggregates or table functions) are identified by their plan: relations with
+	// the same name can have an entirely different structure
+	return LogicalOperatorToString(relation.op.type) + "(" + relation.stats.table_name + ")#" +
+	       to_string(StructuralHash(relation.op));
+}
+
 vector<unique_ptr<SingleJoinRelation>> RelationManager::GetRelations() {
 	return std::move(relations);
 }
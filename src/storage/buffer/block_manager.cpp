@@ -85,6 +85,12 @@ MetadataManager &BlockManager::GetMetadataManager() {
 	return *metadata_manager;
 }
 
+void BlockManager::ReadBlockRuns(vector<BlockReadRun> &runs) {
+	for (auto &run : runs) {
+		ReadBlocks(run.buffer.get(), run.start_block, run.block_count);
+	}
+}
+
 void BlockManager::Truncate() {
 }
 
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/exception.hpp"
 #include "duckdb/parallel/concurrentqueue.hpp"
+#include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/common/chrono.hpp"
 
@@ -193,20 +194,56 @@ void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
+      eviction_policy(BufferEvictionPolicy::LRU), eviction_clock(0),
       temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
-	queues.reserve(FILE_BUFFER_TYPE_COUNT);
-	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT; i++) {
+	queues.reserve(FILE_BUFFER_TYPE_COUNT * 2);
+	for (idx_t i = 0; i < FILE_BUFFER_TYPE_COUNT * 2; i++) {
 		queues.push_back(make_uniq<EvictionQueue>());
 	}
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		evicted_blocks_per_tag[i] = 0;
+		protected_blocks_per_tag[i] = 0;
 	}
 }
 BufferPool::~BufferPool() {
 }
 
+bool BufferPool::ShouldProtect(BlockHandle &handle) {
+	if (eviction_policy != BufferEvictionPolicy::TWO_QUEUE) {
+		return false;
+	}
+	auto now = ++eviction_clock;
+	auto last_unpin = handle.last_unpin_clock.load();
+	handle.last_unpin_clock = now;
+	if (handle.eviction_protected) {
+		// the block was referenced repeatedly before and has not been evicted since
+		return true;
+	}
+	if (last_unpin == 0) {
+		// first reference
+		return false;
+	}
+	// re-references within a short period (e.g., the same scan pinning a block several times) are correlated, and do
+	// not say anything about the block being hot. Re-references after more blocks than fit in the buffer pool have
+	// passed through the queues are treated as a first reference again (i.e., the block is "forgotten").
+	auto block_alloc_size = handle.block_manager.GetOptionalBlockAllocSize();
+	auto block_size = block_alloc_size.IsValid() ? block_alloc_size.GetIndex() : DEFAULT_BLOCK_ALLOC_SIZE;
+	idx_t pool_blocks = MaxValue<idx_t>(maximum_memory / block_size, 4);
+	auto distance = now - last_unpin;
+	if (distance <= pool_blocks / 4 || distance > pool_blocks) {
+		return false;
+	}
+	protected_blocks_per_tag[uint8_t(handle.tag)]++;
+	return true;
+}
+
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
-	auto &queue = GetEvictionQueueForType(handle->buffer->type);
+	auto type = handle->buffer->type;
+	auto &previous_queue = GetEvictionQueueForType(type, handle->eviction_protected);
+	auto is_protected = ShouldProtect(*handle);
+	handle->eviction_protected = is_protected;
+	auto &queue = GetEvictionQueueForType(type, is_protected);
 
 	// The block handle is locked during this operation (Unpin),
 	// or the block handle is still a local variable (ConvertToPersistent)
@@ -221,19 +258,19 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		queue.IncrementDeadNodes();
+		previous_queue.IncrementDeadNodes();
 	}
 
 	// Get the eviction queue for the buffer type and add it
 	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
 }
 
-EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type) {
-	return *queues[uint8_t(type) - 1];
+EvictionQueue &BufferPool::GetEvictionQueueForType(FileBufferType type, bool is_protected) {
+	return *queues[uint8_t(type) - 1 + (is_protected ? FILE_BUFFER_TYPE_COUNT : 0)];
 }
 
-void BufferPool::IncrementDeadNodes(FileBufferType type) {
-	GetEvictionQueueForType(type).IncrementDeadNodes();
+void BufferPool::IncrementDeadNodes(BlockHandle &handle) {
+	GetEvictionQueueForType(handle.buffer->type, handle.eviction_protected).IncrementDeadNodes();
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -262,25 +299,30 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 	return *temporary_memory_manager;
 }
 
+void BufferPool::SetEvictionPolicy(BufferEvictionPolicy policy) {
+	eviction_policy = policy;
+}
+
+BufferEvictionPolicy BufferPool::GetEvictionPolicy() const {
+	return eviction_policy;
+}
+
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
-	// First, we try to evict persistent table data
-	auto block_result =
-	    EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::BLOCK), tag, extra_memory, memory_limit, buffer);
-	if (block_result.success) {
-		return block_result;
-	}
-
-	// If that does not succeed, we try to evict temporary data
-	auto managed_buffer_result = EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::MANAGED_BUFFER), tag,
-	                                                 extra_memory, memory_limit, buffer);
-	if (managed_buffer_result.success) {
-		return managed_buffer_result;
+	// First, we try to evict persistent table data, then temporary data, and finally tiny buffers
+	// For each type of buffer, the protected queue is only considered after the regular queue
+	const FileBufferType types[] = {FileBufferType::BLOCK, FileBufferType::MANAGED_BUFFER,
+	                                FileBufferType::TINY_BUFFER};
+	const idx_t queue_count = 2 * (sizeof(types) / sizeof(FileBufferType));
+	for (idx_t queue_idx = 0; queue_idx + 1 < queue_count; queue_idx++) {
+		auto &queue = GetEvictionQueueForType(types[queue_idx / 2], queue_idx % 2 == 1);
+		auto result = EvictBlocksInternal(queue, tag, extra_memory, memory_limit, buffer);
+		if (result.success) {
+			return result;
+		}
 	}
-
-	// Finally, we try to evict tiny buffers
-	return EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::TINY_BUFFER), tag, extra_memory, memory_limit,
-	                           buffer);
+	return EvictBlocksInternal(GetEvictionQueueForType(FileBufferType::TINY_BUFFER, true), tag, extra_memory,
+	                           memory_limit, buffer);
 }
 
 BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue, MemoryTag tag, idx_t extra_memory,
@@ -294,6 +336,7 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 
 	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
 		// hooray, we can unload the block
+		evicted_blocks_per_tag[uint8_t(handle->tag)]++;
 		if (buffer && handle->buffer->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
 			*buffer = handle->UnloadAndTakeBlock();
@@ -339,6 +382,7 @@ idx_t BufferPool::PurgeAgedBlocksInternal(EvictionQueue &queue, uint32_t max_age
 		// block is younger than the age threshold.
 		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
 		purged_bytes += handle->GetMemoryUsage();
+		evicted_blocks_per_tag[uint8_t(handle->tag)]++;
 		handle->Unload();
 		return is_fresh;
 	});
@@ -381,6 +425,7 @@ void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 
 void BufferPool::PurgeQueue(FileBufferType type) {
 	GetEvictionQueueForType(type).Purge();
+	GetEvictionQueueForType(type, true).Purge();
 }
 
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
@@ -443,7 +443,7 @@ void CheckpointReader::ReadIndex(CatalogTransaction transaction, Deserializer &d
 		}
 	}
 
-	D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
+	D_ASSERT(!index_storage_info.name.empty());
 
 	// Create an unbound index and add it to the table
 	auto unbound_index = make_uniq<UnboundIndex>(std::move(create_info), index_storage_info,
@@ -11,6 +11,7 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/compression/bitpacking.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -871,6 +872,73 @@ void BitpackingScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_c
 	BitpackingScanPartial<T>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T, class T_S = typename MakeSigned<T>::type, class T_U = typename MakeUnsigned<T>::type>
+static FilterPropagateResult BitpackingCheckGroup(BitpackingScanState<T> &scan_state,
+                                                  CompressedRangeFilter &range_filter, idx_t count) {
+	switch (scan_state.current_group.mode) {
+	case BitpackingMode::CONSTANT:
+		return range_filter.CheckBounds<T>(scan_state.current_constant, scan_state.current_constant);
+	case BitpackingMode::CONSTANT_DELTA: {
+		// the values are monotonic: the bounds are the first and the last value
+		auto first_index = static_cast<T_U>(scan_state.current_group_offset);
+		auto last_index = static_cast<T_U>(scan_state.current_group_offset + count - 1);
+		auto first = static_cast<T>(static_cast<T_U>(scan_state.current_constant) * first_index +
+		                            static_cast<T_U>(scan_state.current_frame_of_reference));
+		auto last = static_cast<T>(static_cast<T_U>(scan_state.current_constant) * last_index +
+		                           static_cast<T_U>(scan_state.current_frame_of_reference));
+		return range_filter.CheckBounds<T>(MinValue(first, last), MaxValue(first, last));
+	}
+	case BitpackingMode::FOR: {
+		// the values are at least the frame of reference, and at most 2^width - 1 larger
+		if (scan_state.current_width >= sizeof(T) * 8) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		auto max_offset = static_cast<T_U>((static_cast<T_U>(1) << scan_state.current_width) - 1);
+		auto max = static_cast<T>(static_cast<T_U>(scan_state.current_frame_of_reference) + max_offset);
+		if (max < scan_state.current_frame_of_reference) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return range_filter.CheckBounds<T>(scan_state.current_frame_of_reference, max);
+	}
+	default:
+		// the bounds of delta encoded groups are not known without decompressing them
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+template <class T>
+void BitpackingFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                      SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<BitpackingScanState<T>>();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+
+	CompressedRangeFilter range_filter(filter, segment.type);
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		if (scan_state.current_group_offset == BITPACKING_METADATA_GROUP_SIZE) {
+			scan_state.LoadNextGroup();
+		}
+		auto to_scan =
+		    MinValue<idx_t>(vector_count - scanned, BITPACKING_METADATA_GROUP_SIZE - scan_state.current_group_offset);
+		auto prune_result = BitpackingCheckGroup<T>(scan_state, range_filter, to_scan);
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    prune_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			// none of the values in this group pass the filter: skip it without unpacking
+			// only non-delta groups can be pruned, skipping within them only moves the offset
+			D_ASSERT(scan_state.current_group.mode != BitpackingMode::DELTA_FOR);
+			scan_state.current_group_offset += to_scan;
+		} else {
+			BitpackingScanPartial<T>(segment, state, to_scan, result, scanned);
+		}
+		range_filter.SetRange(scanned, scanned + to_scan, prune_result);
+		scanned += to_scan;
+	}
+	range_filter.Select(result, vector_count, sel, sel_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -949,25 +1017,33 @@ CompressionFunction GetBitpackingFunction(PhysicalType data_type) {
 	                           BitpackingScan<T>, BitpackingScanPartial<T>, BitpackingFetchRow<T>, BitpackingSkip<T>);
 }
 
+template <class T>
+CompressionFunction GetBitpackingFilterFunction(PhysicalType data_type) {
+	auto function = GetBitpackingFunction<T>(data_type);
+	function.filter = BitpackingFilter<T>;
+	return function;
+}
+
 CompressionFunction BitpackingFun::GetFunction(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::BOOL:
-	case PhysicalType::INT8:
 		return GetBitpackingFunction<int8_t>(type);
+	case PhysicalType::INT8:
+		return GetBitpackingFilterFunction<int8_t>(type);
 	case PhysicalType::INT16:
-		return GetBitpackingFunction<int16_t>(type);
+		return GetBitpackingFilterFunction<int16_t>(type);
 	case PhysicalType::INT32:
-		return GetBitpackingFunction<int32_t>(type);
+		return GetBitpackingFilterFunction<int32_t>(type);
 	case PhysicalType::INT64:
-		return GetBitpackingFunction<int64_t>(type);
+		return GetBitpackingFilterFunction<int64_t>(type);
 	case PhysicalType::UINT8:
-		return GetBitpackingFunction<uint8_t>(type);
+		return GetBitpackingFilterFunction<uint8_t>(type);
 	case PhysicalType::UINT16:
-		return GetBitpackingFunction<uint16_t>(type);
+		return GetBitpackingFilterFunction<uint16_t>(type);
 	case PhysicalType::UINT32:
-		return GetBitpackingFunction<uint32_t>(type);
+		return GetBitpackingFilterFunction<uint32_t>(type);
 	case PhysicalType::UINT64:
-		return GetBitpackingFunction<uint64_t>(type);
+		return GetBitpackingFilterFunction<uint64_t>(type);
 	case PhysicalType::INT128:
 		return GetBitpackingFunction<hugeint_t>(type);
 	case PhysicalType::UINT128:
@@ -0,0 +1,109 @@
+#include "duckdb/storage/compression/compressed_filter.hpp"
+
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+
+namespace duckdb {
+
+bool CompressedFilter::CanFilter(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+	case TableFilterType::IS_NOT_NULL:
+		return true;
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (!CanFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (!CanFilter(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+void CompressedFilter::FilterValues(Vector &values, idx_t count, const TableFilter &filter, bool *matches) {
+	SelectionVector values_sel;
+	idx_t approved_count = count;
+	UnifiedVectorFormat vdata;
+	values.ToUnifiedFormat(count, vdata);
+	ColumnSegment::FilterSelection(values_sel, values, vdata, filter, count, approved_count);
+
+	memset(matches, 0, count * sizeof(bool));
+	for (idx_t i = 0; i < approved_count; i++) {
+		matches[values_sel.get_index(i)] = true;
+	}
+}
+
+void CompressedFilter::SelectMatches(const bool *matches, SelectionVector &sel, idx_t &sel_count) {
+	SelectionVector new_sel(sel_count);
+	idx_t new_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		new_sel.set_index(new_count, idx);
+		new_count += matches[idx];
+	}
+	sel.Initialize(new_sel);
+	sel_count = new_count;
+}
+
+CompressedRangeFilter::CompressedRangeFilter(const TableFilter &filter, const LogicalType &type)
+    : filter(filter), type(type) {
+}
+
+void CompressedRangeFilter::SetRange(idx_t start, idx_t end, FilterPropagateResult result) {
+	D_ASSERT(end <= STANDARD_VECTOR_SIZE);
+	// NULL values are removed by the caller: the filter either passes or fails for the valid values
+	switch (result) {
+	case FilterPropagateResult::FILTER_TRUE_OR_NULL:
+		result = FilterPropagateResult::FILTER_ALWAYS_TRUE;
+		break;
+	case FilterPropagateResult::FILTER_FALSE_OR_NULL:
+		result = FilterPropagateResult::FILTER_ALWAYS_FALSE;
+		break;
+	default:
+		break;
+	}
+	for (idx_t i = start; i < end; i++) {
+		row_results[i] = result;
+	}
+}
+
+void CompressedRangeFilter::Select(Vector &result, idx_t vector_count, SelectionVector &sel, idx_t &sel_count) {
+	bool matches[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < vector_count; i++) {
+		matches[i] = row_results[i] == FilterPropagateResult::FILTER_ALWAYS_TRUE;
+	}
+
+	// compare the rows for which the bounds were inconclusive against their decompressed values
+	SelectionVector compare_sel(sel_count);
+	idx_t compare_count = 0;
+	for (idx_t i = 0; i < sel_count; i++) {
+		auto idx = sel.get_index(i);
+		if (row_results[idx] == FilterPropagateResult::NO_PRUNING_POSSIBLE) {
+			compare_sel.set_index(compare_count++, idx);
+		}
+	}
+	if (compare_count > 0) {
+		UnifiedVectorFormat vdata;
+		result.ToUnifiedFormat(vector_count, vdata);
+		ColumnSegment::FilterSelection(compare_sel, result, vdata, filter, vector_count, compare_count);
+		for (idx_t i = 0; i < compare_count; i++) {
+			matches[compare_sel.get_index(i)] = true;
+		}
+	}
+	CompressedFilter::SelectMatches(matches, sel, sel_count);
+}
+
+} // namespace duckdb
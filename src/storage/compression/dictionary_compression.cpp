@@ -5,6 +5,7 @@
 #include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/string_uncompressed.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
@@ -88,6 +89,8 @@ typedef struct {
 	uint32_t bitpacking_width;
 } dictionary_compression_header_t;
 
+struct CompressedStringScanState;
+
 struct DictionaryCompressionStorage {
 	static constexpr float MINIMUM_COMPRESSION_RATIO = 1.2F;
 	//! Dictionary header size at the beginning of the string segment (offset + length)
@@ -107,6 +110,12 @@ struct DictionaryCompressionStorage {
 	static void StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
 	                              idx_t result_offset);
 	static void StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result);
+	//! Unpacks the dictionary indices of the rows [start, start + count) of the segment into the selection vector of
+	//! the scan state
+	static void UnpackSelection(ColumnSegment &segment, CompressedStringScanState &scan_state, idx_t start,
+	                            idx_t count);
+	static void StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+	                         SelectionVector &sel, idx_t &sel_count, const TableFilter &filter);
 	static void StringFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
 	                           idx_t result_idx);
 
@@ -440,9 +449,13 @@ void DictionaryCompressionStorage::FinalizeCompress(CompressionState &state_p) {
 struct CompressedStringScanState : public StringScanState {
 	BufferHandle handle;
 	buffer_ptr<Vector> dictionary;
+	idx_t dictionary_size;
 	bitpacking_width_t current_width;
 	buffer_ptr<SelectionVector> sel_vec;
 	idx_t sel_vec_size = 0;
+	//! The filter that was last evaluated on the dictionary, and for every dictionary entry whether it passed
+	optional_ptr<const TableFilter> filter;
+	unsafe_unique_array<bool> dictionary_matches;
 };
 
 unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(ColumnSegment &segment) {
@@ -462,6 +475,7 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 	auto index_buffer_ptr = reinterpret_cast<uint32_t *>(baseptr + index_buffer_offset);
 
 	state->dictionary = make_buffer<Vector>(segment.type, index_buffer_count);
+	state->dictionary_size = index_buffer_count;
 	auto dict_child_data = FlatVector::GetData<string_t>(*(state->dictionary));
 
 	for (uint32_t i = 0; i < index_buffer_count; i++) {
@@ -470,6 +484,10 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 		dict_child_data[i] =
 		    FetchStringFromDict(segment, dict, baseptr, UnsafeNumericCast<int32_t>(index_buffer_ptr[i]), str_len);
 	}
+	// the first entry of the dictionary is reserved for NULL values: this allows emitting dictionary vectors with NULLs
+	if (index_buffer_count > 0) {
+		FlatVector::SetNull(*state->dictionary, 0, true);
+	}
 
 	return std::move(state);
 }
@@ -477,6 +495,26 @@ unique_ptr<SegmentScanState> DictionaryCompressionStorage::StringInitScan(Column
 //===--------------------------------------------------------------------===//
 // Scan base data
 //===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::UnpackSelection(ColumnSegment &segment, CompressedStringScanState &scan_state,
+                                                   idx_t start, idx_t count) {
+	// We unpack in blocks of BITPACKING_ALGORITHM_GROUP_SIZE starting from an aligned position
+	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
+	idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(count + start_offset);
+	if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
+		scan_state.sel_vec_size = decompress_count;
+		scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
+	}
+
+	auto base_data = data_ptr_cast(scan_state.handle.Ptr() + segment.GetBlockOffset() + DICTIONARY_HEADER_SIZE);
+	data_ptr_t src = &base_data[((start - start_offset) * scan_state.current_width) / 8];
+	auto dst = scan_state.sel_vec->data();
+	BitpackingPrimitives::UnPackBuffer<sel_t>(data_ptr_cast(dst), src, decompress_count, scan_state.current_width);
+	if (start_offset != 0) {
+		// move the values of the requested rows to the front
+		memmove(dst, dst + start_offset, count * sizeof(sel_t));
+	}
+}
+
 template <bool ALLOW_DICT_VECTORS>
 void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
                                                      Vector &result, idx_t result_offset) {
@@ -494,8 +532,7 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto base_data = data_ptr_cast(baseptr + DICTIONARY_HEADER_SIZE);
 	auto result_data = FlatVector::GetData<string_t>(result);
 
-	if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE ||
-	    start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE != 0) {
+	if (!ALLOW_DICT_VECTORS || result_offset != 0) {
 		// Emit regular vector
 
 		// Handling non-bitpacking-group-aligned start values;
@@ -526,31 +563,50 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 		}
 
 	} else {
-		D_ASSERT(start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE == 0);
-		D_ASSERT(scan_count == STANDARD_VECTOR_SIZE);
-		D_ASSERT(result_offset == 0);
+		// Emit a dict vector that references the dictionary of the segment
+		UnpackSelection(segment, scan_state, start, scan_count);
+		result.Dictionary(*scan_state.dictionary, scan_state.dictionary_size, *scan_state.sel_vec, scan_count);
+	}
+}
 
-		idx_t decompress_count = BitpackingPrimitives::RoundUpToAlgorithmGroupSize(scan_count);
+void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                              Vector &result) {
+	StringScanPartial<true>(segment, state, scan_count, result, 0);
+}
 
-		// Create a selection vector of sufficient size if we don't already have one.
-		if (!scan_state.sel_vec || scan_state.sel_vec_size < decompress_count) {
-			scan_state.sel_vec_size = decompress_count;
-			scan_state.sel_vec = make_buffer<SelectionVector>(decompress_count);
-		}
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+void DictionaryCompressionStorage::StringFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                                Vector &result, SelectionVector &sel, idx_t &sel_count,
+                                                const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
 
-		// Scanning 1024 values, emitting a dict vector
-		data_ptr_t dst = data_ptr_cast(scan_state.sel_vec->data());
-		data_ptr_t src = data_ptr_cast(&base_data[(start * scan_state.current_width) / 8]);
+	// evaluate the filter on the dictionary: this happens once per segment instead of once per row
+	if (scan_state.filter.get() != &filter) {
+		scan_state.dictionary_matches = make_unsafe_uniq_array<bool>(scan_state.dictionary_size);
+		CompressedFilter::FilterValues(*scan_state.dictionary, scan_state.dictionary_size, filter,
+		                               scan_state.dictionary_matches.get());
+		scan_state.filter = &filter;
+	}
 
-		BitpackingPrimitives::UnPackBuffer<sel_t>(dst, src, scan_count, scan_state.current_width);
+	// unpack the dictionary codes of this vector
+	UnpackSelection(segment, scan_state, start, vector_count);
 
-		result.Slice(*(scan_state.dictionary), *scan_state.sel_vec, scan_count);
+	// select the rows by their code
+	auto codes = scan_state.sel_vec->data();
+	bool matches[STANDARD_VECTOR_SIZE];
+	for (idx_t i = 0; i < vector_count; i++) {
+		matches[i] = scan_state.dictionary_matches[codes[i]];
+	}
+	CompressedFilter::SelectMatches(matches, sel, sel_count);
+	if (sel_count == 0) {
+		return;
 	}
-}
 
-void DictionaryCompressionStorage::StringScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
-                                              Vector &result) {
-	StringScanPartial<true>(segment, state, scan_count, result, 0);
+	// the result references the dictionary: no strings are copied
+	result.Dictionary(*scan_state.dictionary, scan_state.dictionary_size, *scan_state.sel_vec, vector_count);
 }
 
 //===--------------------------------------------------------------------===//
@@ -650,13 +706,15 @@ uint16_t DictionaryCompressionStorage::GetStringLength(uint32_t *index_buffer_pt
 // Get Function
 //===--------------------------------------------------------------------===//
 CompressionFunction DictionaryCompressionFun::GetFunction(PhysicalType data_type) {
-	return CompressionFunction(
+	auto function = CompressionFunction(
 	    CompressionType::COMPRESSION_DICTIONARY, data_type, DictionaryCompressionStorage ::StringInitAnalyze,
 	    DictionaryCompressionStorage::StringAnalyze, DictionaryCompressionStorage::StringFinalAnalyze,
 	    DictionaryCompressionStorage::InitCompression, DictionaryCompressionStorage::Compress,
 	    DictionaryCompressionStorage::FinalizeCompress, DictionaryCompressionStorage::StringInitScan,
 	    DictionaryCompressionStorage::StringScan, DictionaryCompressionStorage::StringScanPartial<false>,
 	    DictionaryCompressionStorage::StringFetchRow, UncompressedFunctions::EmptySkip);
+	function.filter = DictionaryCompressionStorage::StringFilter;
+	return function;
 }
 
 bool DictionaryCompressionFun::TypeIsSupported(const CompressionInfo &info) {
@@ -1,6 +1,7 @@
 #include "duckdb/common/types/vector.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -65,6 +66,11 @@ void ConstantScanFunctionValidity(ColumnSegment &segment, ColumnScanState &state
 	}
 }
 
+void ConstantSelectFunctionValidity(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count,
+                                    Vector &result, const SelectionVector &sel, idx_t sel_count) {
+	ConstantScanFunctionValidity(segment, state, sel_count, result);
+}
+
 template <class T>
 void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
 	auto &nstats = segment.stats.statistics;
@@ -74,6 +80,21 @@ void ConstantScanFunction(ColumnSegment &segment, ColumnScanState &state, idx_t
 	result.SetVectorType(VectorType::CONSTANT_VECTOR);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void ConstantFilterFunction(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                            SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	// the filter is evaluated once: either all rows pass or none do
+	ConstantScanFunction<T>(segment, state, vector_count, result);
+	bool match;
+	CompressedFilter::FilterValues(result, 1, filter, &match);
+	if (!match) {
+		sel_count = 0;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -92,16 +113,21 @@ void ConstantFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row
 //===--------------------------------------------------------------------===//
 CompressionFunction ConstantGetFunctionValidity(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::BIT);
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
-	                           ConstantScanPartialValidity, ConstantFetchRowValidity, UncompressedFunctions::EmptySkip);
+	auto function =
+	    CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
+	                        nullptr, nullptr, ConstantInitScan, ConstantScanFunctionValidity,
+	                        ConstantScanPartialValidity, ConstantFetchRowValidity, UncompressedFunctions::EmptySkip);
+	function.select = ConstantSelectFunctionValidity;
+	return function;
 }
 
 template <class T>
 CompressionFunction ConstantGetFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr, nullptr,
-	                           nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>, ConstantScanPartial<T>,
-	                           ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_CONSTANT, data_type, nullptr, nullptr, nullptr,
+	                                    nullptr, nullptr, nullptr, ConstantInitScan, ConstantScanFunction<T>,
+	                                    ConstantScanPartial<T>, ConstantFetchRow<T>, UncompressedFunctions::EmptySkip);
+	function.filter = ConstantFilterFunction<T>;
+	return function;
 }
 
 CompressionFunction ConstantFun::GetFunction(PhysicalType data_type) {
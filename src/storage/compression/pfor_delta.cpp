@@ -0,0 +1,685 @@
+#include "duckdb/common/bitpacking.hpp"
+#include "duckdb/common/limits.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/types/hugeint.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+namespace duckdb {
+
+// PFOR-Delta compresses integers in groups of PFOR_DELTA_GROUP_SIZE values. Every group is stored as either a frame of
+// reference over the values themselves (order 0), over their deltas (order 1) or over their deltas-of-deltas (order 2),
+// whichever packs into the fewest bits. Monotonic sequences such as row ids or timestamps taken at (nearly) regular
+// intervals collapse to a width of zero or a handful of bits per value.
+//
+// Segment layout:
+// [idx_t offset to the end of the metadata]
+// [group 0][group 1]...[group n]
+// [metadata group n]...[metadata group 1][metadata group 0]
+// Every group consists of [uint8_t order][uint8_t width][T reference][T seeds[order]][bitpacked residuals]. The header
+// and the residuals are padded to a multiple of 8 bytes, so that the bitpacking operates on aligned memory.
+// The metadata of every group is the uint32_t offset of the group within the segment.
+static constexpr const idx_t PFOR_DELTA_GROUP_SIZE = STANDARD_VECTOR_SIZE > 512 ? STANDARD_VECTOR_SIZE : 2048;
+static constexpr const idx_t PFOR_DELTA_MAX_ORDER = 2;
+static constexpr const idx_t PFOR_DELTA_HEADER_SIZE = sizeof(uint64_t);
+
+typedef uint32_t pfor_delta_metadata_t;
+
+template <class T>
+struct PForDeltaGroupHeader {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	uint8_t order;
+	bitpacking_width_t width;
+	T_U reference;
+	T_U seeds[PFOR_DELTA_MAX_ORDER];
+
+	idx_t HeaderSize() const {
+		return AlignValue(sizeof(uint8_t) + sizeof(bitpacking_width_t) + sizeof(T) * (1 + order));
+	}
+	idx_t DataSize(idx_t count) const {
+		return AlignValue(BitpackingPrimitives::GetRequiredSize(count - order, width));
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Encoding
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaEncoder {
+	using T_U = typename MakeUnsigned<T>::type;
+	using T_S = typename MakeSigned<T>::type;
+
+	//! Computes the residuals of the cheapest order for the values in "work". On return, work[order...count) holds the
+	//! residuals (already reduced by the reference) and the header describes the group.
+	static PForDeltaGroupHeader<T> Encode(T_U *work, idx_t count) {
+		D_ASSERT(count > 0);
+		PForDeltaGroupHeader<T> best {};
+		idx_t best_size = NumericLimits<idx_t>::Maximum();
+		T_U seeds[PFOR_DELTA_MAX_ORDER];
+		for (idx_t order = 0; order <= PFOR_DELTA_MAX_ORDER && order < count; order++) {
+			if (order > 0) {
+				// turn the sequence of order - 1 into the sequence of order in place: the first element is the seed
+				seeds[order - 1] = work[order - 1];
+				for (idx_t i = count - 1; i >= order; i--) {
+					work[i] = static_cast<T_U>(work[i] - work[i - 1]);
+				}
+			}
+			auto minimum = static_cast<T_S>(work[order]);
+			auto maximum = minimum;
+			for (idx_t i = order + 1; i < count; i++) {
+				auto value = static_cast<T_S>(work[i]);
+				minimum = MinValue(minimum, value);
+				maximum = MaxValue(maximum, value);
+			}
+			PForDeltaGroupHeader<T> header {};
+			header.order = NumericCast<uint8_t>(order);
+			header.reference = static_cast<T_U>(minimum);
+			auto range = static_cast<T_U>(static_cast<T_U>(maximum) - static_cast<T_U>(minimum));
+			header.width = BitpackingPrimitives::MinimumBitWidth<T_U, false>(range);
+			for (idx_t s = 0; s < order; s++) {
+				header.seeds[s] = seeds[s];
+			}
+			auto size = header.HeaderSize() + header.DataSize(count);
+			// on a tie the lower order wins: it is cheaper to decode
+			if (size < best_size) {
+				best = header;
+				best_size = size;
+			}
+		}
+		// undo the differencing until we are back at the best order
+		for (idx_t order = MinValue<idx_t>(PFOR_DELTA_MAX_ORDER, count - 1); order > best.order; order--) {
+			for (idx_t i = order; i < count; i++) {
+				work[i] = static_cast<T_U>(work[i] + work[i - 1]);
+			}
+		}
+		for (idx_t i = best.order; i < count; i++) {
+			work[i] = static_cast<T_U>(work[i] - best.reference);
+		}
+		return best;
+	}
+
+	//! Decodes the first "count" values of a group (at least "order" of them): "buffer" must have room for
+	//! PFOR_DELTA_GROUP_SIZE + BITPACKING_ALGORITHM_GROUP_SIZE values
+	static void Decode(const PForDeltaGroupHeader<T> &header, data_ptr_t data, T_U *buffer, idx_t count) {
+		auto residual_count = count - header.order;
+		auto residuals = buffer + header.order;
+		if (header.width == 0) {
+			std::fill(residuals, residuals + residual_count, header.reference);
+		} else {
+			BitpackingPrimitives::UnPackBuffer<T_U>(data_ptr_cast(residuals), data, residual_count, header.width,
+			                                        true);
+			for (idx_t i = 0; i < residual_count; i++) {
+				residuals[i] = static_cast<T_U>(residuals[i] + header.reference);
+			}
+		}
+		// integrate the residuals once per order, from the highest order down to the values
+		for (idx_t order = header.order; order > 0; order--) {
+			buffer[order - 1] = header.seeds[order - 1];
+			for (idx_t i = order; i < count; i++) {
+				buffer[i] = static_cast<T_U>(buffer[i] + buffer[i - 1]);
+			}
+		}
+	}
+};
+
+//! Buffers values into groups. NULL values are replaced by a linear extrapolation of the preceding values, which
+//! keeps the deltas-of-deltas at zero for NULLs in otherwise regular sequences.
+template <class T, class OP>
+struct PForDeltaState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	T_U values[PFOR_DELTA_GROUP_SIZE];
+	idx_t count = 0;
+	//! The number of leading NULLs in the column that are waiting for the first valid value
+	idx_t leading_nulls = 0;
+	bool has_last = false;
+	T_U last_value = 0;
+	T_U last_delta = 0;
+	//! The statistics of the valid values of the current group
+	bool has_valid = false;
+	T minimum = NumericLimits<T>::Maximum();
+	T maximum = NumericLimits<T>::Minimum();
+
+	void Update(T value, bool is_valid, OP &op) {
+		T_U entry;
+		if (is_valid) {
+			entry = static_cast<T_U>(value);
+			if (!has_last) {
+				for (idx_t i = count - leading_nulls; i < count; i++) {
+					values[i] = entry;
+				}
+				leading_nulls = 0;
+			}
+			has_valid = true;
+			minimum = MinValue(minimum, value);
+			maximum = MaxValue(maximum, value);
+		} else if (has_last) {
+			entry = static_cast<T_U>(last_value + last_delta);
+		} else {
+			entry = 0;
+			leading_nulls++;
+		}
+		if (has_last || is_valid) {
+			last_delta = has_last ? static_cast<T_U>(entry - last_value) : T_U(0);
+			last_value = entry;
+			has_last = true;
+		}
+		values[count++] = entry;
+		if (count == PFOR_DELTA_GROUP_SIZE) {
+			Flush(op);
+		}
+	}
+
+	void Flush(OP &op) {
+		if (count == 0) {
+			return;
+		}
+		op.WriteGroup(values, count, has_valid, minimum, maximum);
+		count = 0;
+		leading_nulls = 0;
+		has_valid = false;
+		minimum = NumericLimits<T>::Maximum();
+		maximum = NumericLimits<T>::Minimum();
+	}
+};
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaAnalyzeState : public AnalyzeState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	explicit PForDeltaAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	PForDeltaState<T, PForDeltaAnalyzeState<T>> state;
+	idx_t total_size = 0;
+
+	void WriteGroup(T_U *values, idx_t count, bool, T, T) {
+		auto header = PForDeltaEncoder<T>::Encode(values, count);
+		total_size += header.HeaderSize() + header.DataSize(count) + sizeof(pfor_delta_metadata_t);
+	}
+};
+
+template <class T>
+unique_ptr<AnalyzeState> PForDeltaInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(Storage::BLOCK_SIZE, type);
+	return make_uniq<PForDeltaAnalyzeState<T>>(info);
+}
+
+template <class T>
+bool PForDeltaAnalyze(AnalyzeState &state, Vector &input, idx_t count) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		analyze_state.state.Update(data[idx], vdata.validity.RowIsValid(idx), analyze_state);
+	}
+	return true;
+}
+
+template <class T>
+idx_t PForDeltaFinalAnalyze(AnalyzeState &state) {
+	auto &analyze_state = state.Cast<PForDeltaAnalyzeState<T>>();
+	analyze_state.state.Flush(analyze_state);
+	return analyze_state.total_size;
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaCompressState : public CompressionState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	PForDeltaCompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_PFOR_DELTA)) {
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+
+	data_ptr_t data_ptr;
+	data_ptr_t metadata_ptr;
+
+	PForDeltaState<T, PForDeltaCompressState<T>> state;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + PFOR_DELTA_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+	}
+
+	bool CanStore(idx_t data_bytes) {
+		auto required = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr - handle.Ptr()) + data_bytes) +
+		                NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) +
+		                sizeof(pfor_delta_metadata_t);
+		return required <= info.GetBlockSize();
+	}
+
+	void WriteGroup(T_U *values, idx_t count, bool has_valid, T minimum, T maximum) {
+		auto header = PForDeltaEncoder<T>::Encode(values, count);
+		auto group_size = header.HeaderSize() + header.DataSize(count);
+		if (!CanStore(group_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(group_size));
+
+		metadata_ptr -= sizeof(pfor_delta_metadata_t);
+		Store<pfor_delta_metadata_t>(NumericCast<pfor_delta_metadata_t>(data_ptr - handle.Ptr()), metadata_ptr);
+
+		// zero-initialize the group, which also clears the padding
+		memset(data_ptr, 0, group_size);
+		auto header_ptr = data_ptr;
+		Store<uint8_t>(header.order, header_ptr);
+		header_ptr += sizeof(uint8_t);
+		Store<bitpacking_width_t>(header.width, header_ptr);
+		header_ptr += sizeof(bitpacking_width_t);
+		Store<T_U>(header.reference, header_ptr);
+		header_ptr += sizeof(T);
+		for (idx_t s = 0; s < header.order; s++) {
+			Store<T_U>(header.seeds[s], header_ptr);
+			header_ptr += sizeof(T);
+		}
+		data_ptr += header.HeaderSize();
+		if (header.width > 0) {
+			BitpackingPrimitives::PackBuffer<T_U, false>(data_ptr, values + header.order, count - header.order,
+			                                             header.width);
+			data_ptr += header.DataSize(count);
+		}
+
+		current_segment->count += count;
+		if (has_valid) {
+			NumericStats::Update<T>(current_segment->stats.statistics, minimum);
+			NumericStats::Update<T>(current_segment->stats.statistics, maximum);
+		}
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t count) {
+		auto data = UnifiedVectorFormat::GetData<T>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			state.Update(data[idx], vdata.validity.RowIsValid(idx), *this);
+		}
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		auto unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_offset = AlignValue(unaligned_offset);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+		if (unaligned_offset != metadata_offset) {
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+		Store<idx_t>(metadata_offset + metadata_size, base_ptr);
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		state.Flush(*this);
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+template <class T>
+unique_ptr<CompressionState> PForDeltaInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                      unique_ptr<AnalyzeState> state) {
+	return make_uniq<PForDeltaCompressState<T>>(checkpointer, state->info);
+}
+
+template <class T>
+void PForDeltaCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+template <class T>
+void PForDeltaFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<PForDeltaCompressState<T>>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+template <class T>
+struct PForDeltaScanState : public SegmentScanState {
+	using T_U = typename MakeUnsigned<T>::type;
+
+	explicit PForDeltaScanState(ColumnSegment &segment_p) : segment(segment_p) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		metadata_end = base_ptr + Load<idx_t>(base_ptr);
+	}
+
+	ColumnSegment &segment;
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	data_ptr_t metadata_end;
+
+	//! The row within the segment that the next scan starts at
+	idx_t position = 0;
+	//! The group that is currently (partially) decoded into the buffer, and the number of its values that are decoded
+	idx_t decoded_group = DConstants::INVALID_INDEX;
+	idx_t decoded_count = 0;
+	T_U buffer[PFOR_DELTA_GROUP_SIZE + BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE];
+
+public:
+	idx_t GroupCount(idx_t group_idx) const {
+		return MinValue<idx_t>(PFOR_DELTA_GROUP_SIZE, segment.count - group_idx * PFOR_DELTA_GROUP_SIZE);
+	}
+
+	//! Reads the header of a group, and returns a pointer to its bitpacked residuals
+	data_ptr_t LoadHeader(idx_t group_idx, PForDeltaGroupHeader<T> &header) {
+		auto group_offset =
+		    Load<pfor_delta_metadata_t>(metadata_end - (group_idx + 1) * sizeof(pfor_delta_metadata_t));
+		auto group_ptr = base_ptr + group_offset;
+
+		auto header_ptr = group_ptr;
+		header.order = Load<uint8_t>(header_ptr);
+		header_ptr += sizeof(uint8_t);
+		header.width = Load<bitpacking_width_t>(header_ptr);
+		header_ptr += sizeof(bitpacking_width_t);
+		header.reference = Load<T_U>(header_ptr);
+		header_ptr += sizeof(T);
+		for (idx_t s = 0; s < header.order; s++) {
+			header.seeds[s] = Load<T_U>(header_ptr);
+			header_ptr += sizeof(T);
+		}
+		return group_ptr + header.HeaderSize();
+	}
+
+	//! Decodes the first "row_count" values of a group into the buffer if they are not decoded yet. The values are
+	//! integrated from the start of the group, so the rows after the last requested row do not have to be decoded.
+	void LoadGroup(idx_t group_idx, idx_t row_count) {
+		if (group_idx == decoded_group && row_count <= decoded_count) {
+			return;
+		}
+		PForDeltaGroupHeader<T> header {};
+		auto residuals = LoadHeader(group_idx, header);
+		auto decode_count = MaxValue<idx_t>(row_count, header.order);
+		D_ASSERT(decode_count <= GroupCount(group_idx));
+		PForDeltaEncoder<T>::Decode(header, residuals, buffer, decode_count);
+		decoded_group = group_idx;
+		decoded_count = decode_count;
+	}
+
+	void Scan(T *result, idx_t count) {
+		idx_t scanned = 0;
+		while (scanned < count) {
+			auto group_idx = position / PFOR_DELTA_GROUP_SIZE;
+			auto offset_in_group = position % PFOR_DELTA_GROUP_SIZE;
+			auto to_scan = MinValue<idx_t>(count - scanned, PFOR_DELTA_GROUP_SIZE - offset_in_group);
+			// scans usually continue with the rest of the group: decode all of it
+			LoadGroup(group_idx, GroupCount(group_idx));
+			memcpy(result + scanned, buffer + offset_in_group, to_scan * sizeof(T));
+			scanned += to_scan;
+			position += to_scan;
+		}
+	}
+};
+
+template <class T>
+unique_ptr<SegmentScanState> PForDeltaInitScan(ColumnSegment &segment) {
+	return make_uniq<PForDeltaScanState<T>>(segment);
+}
+
+template <class T>
+void PForDeltaScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                          idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	scan_state.Scan(result_data + result_offset, scan_count);
+}
+
+template <class T>
+void PForDeltaScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	PForDeltaScanPartial<T>(segment, state, scan_count, result, 0);
+}
+
+template <class T>
+void PForDeltaSkip(ColumnSegment &segment, ColumnScanState &state, idx_t skip_count) {
+	// groups are decoded lazily, skipping only moves the position
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	scan_state.position += skip_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+//! Computes bounds on the values of a group from its header, without decoding its residuals: every residual lies within
+//! [reference, reference + 2^width - 1]. The bounds are computed without wrapping around, and are only returned if they
+//! fit into T - in that case the values (which are decoded with wrap-around) lie within them as well.
+template <class T>
+static bool PForDeltaGroupBounds(const PForDeltaGroupHeader<T> &header, idx_t count, T &min, T &max) {
+	using T_S = typename MakeSigned<T>::type;
+
+	auto max_residual = (hugeint_t(1) << hugeint_t(header.width)) - hugeint_t(1);
+	auto last = Hugeint::Convert(count - 1);
+	hugeint_t lower;
+	hugeint_t upper;
+	if (header.order == 0) {
+		// frame of reference over the values
+		lower = Hugeint::Convert(static_cast<T>(header.reference));
+		upper = lower + max_residual;
+	} else if (header.order == 1) {
+		// frame of reference over the deltas: the values move away from the seed by at most (count - 1) deltas
+		auto seed = Hugeint::Convert(static_cast<T>(header.seeds[0]));
+		auto min_delta = Hugeint::Convert(static_cast<T_S>(header.reference));
+		auto max_delta = min_delta + max_residual;
+		lower = seed + MinValue<hugeint_t>(hugeint_t(0), last * min_delta);
+		upper = seed + MaxValue<hugeint_t>(hugeint_t(0), last * max_delta);
+	} else {
+		// frame of reference over the deltas-of-deltas: value i is at least (most) the quadratic
+		// seed + i * first_delta + i * (i - 1) / 2 * min_delta (max_delta). Its extremes over [0, count - 1] are at the
+		// ends of the group or next to its vertex.
+		D_ASSERT(header.order == 2);
+		auto seed = Hugeint::Convert(static_cast<T>(header.seeds[0]));
+		auto first_delta = Hugeint::Convert(static_cast<T_S>(header.seeds[1]));
+		auto min_delta = Hugeint::Convert(static_cast<T_S>(header.reference));
+		auto max_delta = min_delta + max_residual;
+		auto extreme = [&](const hugeint_t &delta, bool minimum) {
+			idx_t candidates[4] = {0, count - 1, 0, 0};
+			if (delta != hugeint_t(0)) {
+				auto vertex = 0.5 - Hugeint::Cast<double>(first_delta) / Hugeint::Cast<double>(delta);
+				auto clamped = MaxValue<double>(0, MinValue<double>(vertex, static_cast<double>(count - 1)));
+				candidates[2] = static_cast<idx_t>(clamped);
+				candidates[3] = MinValue<idx_t>(candidates[2] + 1, count - 1);
+			}
+			hugeint_t result;
+			for (idx_t c = 0; c < 4; c++) {
+				auto i = Hugeint::Convert(candidates[c]);
+				auto value = seed + i * first_delta + i * (i - hugeint_t(1)) / hugeint_t(2) * delta;
+				if (c == 0 || (minimum ? value < result : value > result)) {
+					result = value;
+				}
+			}
+			return result;
+		};
+		lower = extreme(min_delta, true);
+		upper = extreme(max_delta, false);
+	}
+	return Hugeint::TryCast<T>(lower, min) && Hugeint::TryCast<T>(upper, max);
+}
+
+template <class T>
+void PForDeltaFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                     SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+
+	// the filter is checked against the bounds of every group: groups that cannot pass it are not decoded
+	CompressedRangeFilter range_filter(filter, segment.type);
+	idx_t scanned = 0;
+	while (scanned < vector_count) {
+		auto group_idx = scan_state.position / PFOR_DELTA_GROUP_SIZE;
+		auto offset_in_group = scan_state.position % PFOR_DELTA_GROUP_SIZE;
+		auto to_scan = MinValue<idx_t>(vector_count - scanned, PFOR_DELTA_GROUP_SIZE - offset_in_group);
+
+		auto prune_result = FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		PForDeltaGroupHeader<T> header {};
+		scan_state.LoadHeader(group_idx, header);
+		T min, max;
+		if (PForDeltaGroupBounds<T>(header, scan_state.GroupCount(group_idx), min, max)) {
+			prune_result = range_filter.CheckBounds<T>(min, max);
+		}
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE ||
+		    prune_result == FilterPropagateResult::FILTER_FALSE_OR_NULL) {
+			scan_state.position += to_scan;
+		} else {
+			scan_state.Scan(result_data + scanned, to_scan);
+		}
+		range_filter.SetRange(scanned, scanned + to_scan, prune_result);
+		scanned += to_scan;
+	}
+	range_filter.Select(result, vector_count, sel, sel_count);
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaSelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                     const SelectionVector &sel, idx_t sel_count) {
+	// only the groups that contain selected rows are decoded, up to their last selected row
+	auto &scan_state = state.scan_state->Cast<PForDeltaScanState<T>>();
+	auto start = scan_state.position;
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	for (idx_t i = 0; i < sel_count;) {
+		// find the selected rows that follow within the same group, and the last one of them
+		auto group_idx = (start + sel.get_index(i)) / PFOR_DELTA_GROUP_SIZE;
+		auto group_start = group_idx * PFOR_DELTA_GROUP_SIZE;
+		idx_t end = i;
+		idx_t row_count = 0;
+		for (; end < sel_count; end++) {
+			auto row = start + sel.get_index(end);
+			if (row < group_start || row >= group_start + PFOR_DELTA_GROUP_SIZE) {
+				break;
+			}
+			row_count = MaxValue<idx_t>(row_count, row - group_start + 1);
+		}
+		scan_state.LoadGroup(group_idx, row_count);
+		for (; i < end; i++) {
+			result_data[i] = static_cast<T>(scan_state.buffer[start + sel.get_index(i) - group_start]);
+		}
+	}
+	scan_state.position = start + vector_count;
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+template <class T>
+void PForDeltaFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result,
+                       idx_t result_idx) {
+	// only the values up to the requested row are decoded
+	PForDeltaScanState<T> scan_state(segment);
+	auto row = NumericCast<idx_t>(row_id);
+	auto group_idx = row / PFOR_DELTA_GROUP_SIZE;
+	auto offset_in_group = row % PFOR_DELTA_GROUP_SIZE;
+	scan_state.LoadGroup(group_idx, offset_in_group + 1);
+	auto result_data = FlatVector::GetData<T>(result);
+	result_data[result_idx] = static_cast<T>(scan_state.buffer[offset_in_group]);
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+template <class T>
+CompressionFunction GetPForDeltaFunction(PhysicalType data_type) {
+	CompressionFunction function(CompressionType::COMPRESSION_PFOR_DELTA, data_type, PForDeltaInitAnalyze<T>,
+	                             PForDeltaAnalyze<T>, PForDeltaFinalAnalyze<T>, PForDeltaInitCompression<T>,
+	                             PForDeltaCompress<T>, PForDeltaFinalizeCompress<T>, PForDeltaInitScan<T>,
+	                             PForDeltaScan<T>, PForDeltaScanPartial<T>, PForDeltaFetchRow<T>, PForDeltaSkip<T>);
+	function.filter = PForDeltaFilter<T>;
+	function.select = PForDeltaSelect<T>;
+	return function;
+}
+
+CompressionFunction PForDeltaFun::GetFunction(PhysicalType type) {
+	switch (type) {
+	case PhysicalType::INT8:
+		return GetPForDeltaFunction<int8_t>(type);
+	case PhysicalType::INT16:
+		return GetPForDeltaFunction<int16_t>(type);
+	case PhysicalType::INT32:
+		return GetPForDeltaFunction<int32_t>(type);
+	case PhysicalType::INT64:
+		return GetPForDeltaFunction<int64_t>(type);
+	case PhysicalType::UINT8:
+		return GetPForDeltaFunction<uint8_t>(type);
+	case PhysicalType::UINT16:
+		return GetPForDeltaFunction<uint16_t>(type);
+	case PhysicalType::UINT32:
+		return GetPForDeltaFunction<uint32_t>(type);
+	case PhysicalType::UINT64:
+		return GetPForDeltaFunction<uint64_t>(type);
+	default:
+		throw InternalException("Unsupported type for PFOR-Delta");
+	}
+}
+
+bool PForDeltaFun::TypeIsSupported(const CompressionInfo &info) {
+	// a group that does not compress at all has to fit into a single block
+	auto type_size = GetTypeIdSize(info.GetPhysicalType());
+	if (type_size * PFOR_DELTA_GROUP_SIZE * 2 > info.GetBlockSize()) {
+		return false;
+	}
+
+	switch (info.GetPhysicalType()) {
+	case PhysicalType::INT8:
+	case PhysicalType::INT16:
+	case PhysicalType::INT32:
+	case PhysicalType::INT64:
+	case PhysicalType::UINT8:
+	case PhysicalType::UINT16:
+	case PhysicalType::UINT32:
+	case PhysicalType::UINT64:
+		return true;
+	default:
+		return false;
+	}
+}
+
+} // namespace duckdb
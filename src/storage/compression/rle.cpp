@@ -1,6 +1,7 @@
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/function/compression/compression.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/storage/table/column_segment.hpp"
@@ -373,6 +374,53 @@ void RLEScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, V
 	RLEScanPartialInternal<T, true>(segment, state, scan_count, result, 0);
 }
 
+//===--------------------------------------------------------------------===//
+// Filter
+//===--------------------------------------------------------------------===//
+template <class T>
+void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+               SelectionVector &sel, idx_t &sel_count, const TableFilter &filter) {
+	auto &scan_state = state.scan_state->Cast<RLEScanState<T>>();
+
+	auto data = scan_state.handle.Ptr() + segment.GetBlockOffset();
+	auto data_pointer = reinterpret_cast<T *>(data + RLEConstants::RLE_HEADER_SIZE);
+	auto index_pointer = reinterpret_cast<rle_count_t *>(data + scan_state.rle_count_offset);
+
+	// gather the values of the runs in this vector, and evaluate the filter once per run
+	Vector run_values(segment.type, vector_count);
+	auto run_data = FlatVector::GetData<T>(run_values);
+	idx_t run_ends[STANDARD_VECTOR_SIZE];
+	idx_t run_count = 0;
+	for (idx_t scanned = 0; scanned < vector_count;) {
+		auto remaining_in_run = index_pointer[scan_state.entry_pos] - scan_state.position_in_entry;
+		auto to_scan = MinValue<idx_t>(remaining_in_run, vector_count - scanned);
+		run_data[run_count] = data_pointer[scan_state.entry_pos];
+		scanned += to_scan;
+		run_ends[run_count++] = scanned;
+		scan_state.position_in_entry += to_scan;
+		if (ExhaustedRun(scan_state, index_pointer)) {
+			ForwardToNextRun(scan_state);
+		}
+	}
+	bool run_matches[STANDARD_VECTOR_SIZE];
+	CompressedFilter::FilterValues(run_values, run_count, filter, run_matches);
+
+	// only the rows of the runs that pass the filter are written to the result
+	bool matches[STANDARD_VECTOR_SIZE];
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	idx_t run_start = 0;
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		auto run_end = run_ends[run_idx];
+		if (run_matches[run_idx]) {
+			std::fill(result_data + run_start, result_data + run_end, run_data[run_idx]);
+		}
+		std::fill(matches + run_start, matches + run_end, run_matches[run_idx]);
+		run_start = run_end;
+	}
+	CompressedFilter::SelectMatches(matches, sel, sel_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -392,10 +440,15 @@ void RLEFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id,
 //===--------------------------------------------------------------------===//
 template <class T, bool WRITE_STATISTICS = true>
 CompressionFunction GetRLEFunction(PhysicalType data_type) {
-	return CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
-	                           RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
-	                           RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
-	                           RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	auto function = CompressionFunction(CompressionType::COMPRESSION_RLE, data_type, RLEInitAnalyze<T>, RLEAnalyze<T>,
+	                                    RLEFinalAnalyze<T>, RLEInitCompression<T, WRITE_STATISTICS>,
+	                                    RLECompress<T, WRITE_STATISTICS>, RLEFinalizeCompress<T, WRITE_STATISTICS>,
+	                                    RLEInitScan<T>, RLEScan<T>, RLEScanPartial<T>, RLEFetchRow<T>, RLESkip<T>);
+	if (WRITE_STATISTICS) {
+		// segments without statistics store offsets of nested types, which are never filtered
+		function.filter = RLEFilter<T>;
+	}
+	return function;
 }
 
 CompressionFunction RLEFun::GetFunction(PhysicalType type) {
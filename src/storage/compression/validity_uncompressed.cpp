@@ -341,7 +341,35 @@ void ValidityScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t s
 #endif
 }
 
+//! Whether the NULL values of a dictionary vector (e.g. as emitted by a dictionary compressed segment) already match
+//! the validity of the segment, in which case the dictionary vector does not have to be flattened
+static bool ValidityMatchesDictionary(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count,
+                                      Vector &result) {
+	if (result.GetVectorType() != VectorType::DICTIONARY_VECTOR) {
+		return false;
+	}
+	auto &child = DictionaryVector::Child(result);
+	if (child.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	auto &sel = DictionaryVector::SelVector(result);
+	auto &child_mask = FlatVector::Validity(child);
+
+	auto &scan_state = state.scan_state->Cast<ValidityScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	ValidityMask input_mask(reinterpret_cast<validity_t *>(scan_state.handle.Ptr() + segment.GetBlockOffset()));
+	for (idx_t i = 0; i < scan_count; i++) {
+		if (input_mask.RowIsValid(start + i) != child_mask.RowIsValid(sel.get_index(i))) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void ValidityScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	if (ValidityMatchesDictionary(segment, state, scan_count, result)) {
+		return;
+	}
 	result.Flatten(scan_count);
 
 	auto start = segment.GetRelativeIndex(state.row_index);
@@ -375,6 +403,24 @@ void ValidityScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_cou
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void ValiditySelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                    const SelectionVector &sel, idx_t sel_count) {
+	result.Flatten(sel_count);
+
+	auto &scan_state = state.scan_state->Cast<ValidityScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+	ValidityMask input_mask(reinterpret_cast<validity_t *>(scan_state.handle.Ptr() + segment.GetBlockOffset()));
+	auto &result_mask = FlatVector::Validity(result);
+	for (idx_t i = 0; i < sel_count; i++) {
+		if (!input_mask.RowIsValid(start + sel.get_index(i))) {
+			result_mask.SetInvalid(i);
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -468,12 +514,14 @@ void ValidityRevertAppend(ColumnSegment &segment, idx_t start_row) {
 //===--------------------------------------------------------------------===//
 CompressionFunction ValidityUncompressed::GetFunction(PhysicalType data_type) {
 	D_ASSERT(data_type == PhysicalType::BIT);
-	return CompressionFunction(CompressionType::COMPRESSION_UNCOMPRESSED, data_type, ValidityInitAnalyze,
-	                           ValidityAnalyze, ValidityFinalAnalyze, UncompressedFunctions::InitCompression,
-	                           UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
-	                           ValidityInitScan, ValidityScan, ValidityScanPartial, ValidityFetchRow,
-	                           UncompressedFunctions::EmptySkip, ValidityInitSegment, ValidityInitAppend,
-	                           ValidityAppend, ValidityFinalizeAppend, ValidityRevertAppend);
+	CompressionFunction function(CompressionType::COMPRESSION_UNCOMPRESSED, data_type, ValidityInitAnalyze,
+	                             ValidityAnalyze, ValidityFinalAnalyze, UncompressedFunctions::InitCompression,
+	                             UncompressedFunctions::Compress, UncompressedFunctions::FinalizeCompress,
+	                             ValidityInitScan, ValidityScan, ValidityScanPartial, ValidityFetchRow,
+	                             UncompressedFunctions::EmptySkip, ValidityInitSegment, ValidityInitAppend,
+	                             ValidityAppend, ValidityFinalizeAppend, ValidityRevertAppend);
+	function.select = ValiditySelect;
+	return function;
 }
 
 } // namespace duckdb
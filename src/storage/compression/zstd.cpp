@@ -0,0 +1,425 @@
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/function/compression/compression.hpp"
+#include "duckdb/function/compression_function.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/segment/uncompressed.hpp"
+#include "duckdb/storage/string_uncompressed.hpp"
+#include "duckdb/storage/table/column_data_checkpointer.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+
+#include "zstd.h"
+
+namespace duckdb {
+
+// ZSTD compresses strings in frames of up to ZSTD_FRAME_SIZE rows. Every frame is compressed independently, so a scan
+// or a point lookup only has to decompress the frames that contain the rows it needs. ZSTD is not considered by the
+// automatic compression selection: it trades scan speed for size, and is only used when it is explicitly requested for
+// a column (e.g. for cold log or JSON payload columns).
+//
+// Segment layout:
+// [uint32_t offset to the end of the metadata][uint32_t frame count]
+// [frame 0][frame 1]...[frame n]
+// [metadata frame n]...[metadata frame 1][metadata frame 0]
+// Every frame consists of [uint32_t compressed size][uint32_t decompressed size][zstd compressed data]
+// The decompressed data of a frame is [uint32_t lengths[count]][string data]. NULL values are stored as empty strings.
+// The metadata of every frame is the uint32_t first row of the frame followed by the uint32_t offset of the frame.
+static constexpr const idx_t ZSTD_FRAME_SIZE = STANDARD_VECTOR_SIZE;
+static constexpr const idx_t ZSTD_HEADER_SIZE = 2 * sizeof(uint32_t);
+static constexpr const idx_t ZSTD_FRAME_HEADER_SIZE = 2 * sizeof(uint32_t);
+static constexpr const idx_t ZSTD_METADATA_SIZE = 2 * sizeof(uint32_t);
+
+//! The maximum decompressed size of a frame. Strings that do not fit into a frame by themselves cannot be compressed.
+static idx_t ZSTDFrameLimit(idx_t block_size) {
+	return block_size / 4;
+}
+
+//===--------------------------------------------------------------------===//
+// Analyze
+//===--------------------------------------------------------------------===//
+struct ZSTDAnalyzeState : public AnalyzeState {
+	explicit ZSTDAnalyzeState(const CompressionInfo &info) : AnalyzeState(info) {
+	}
+
+	idx_t count = 0;
+	idx_t total_string_size = 0;
+};
+
+unique_ptr<AnalyzeState> ZSTDInitAnalyze(ColumnData &col_data, PhysicalType type) {
+	CompressionInfo info(Storage::BLOCK_SIZE, type);
+	return make_uniq<ZSTDAnalyzeState>(info);
+}
+
+bool ZSTDAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+
+	auto frame_limit = ZSTDFrameLimit(state.info.GetBlockSize());
+	auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			continue;
+		}
+		auto string_size = data[idx].GetSize();
+		if (sizeof(uint32_t) + string_size > frame_limit) {
+			return false;
+		}
+		state.total_string_size += string_size;
+	}
+	state.count += count;
+	return true;
+}
+
+idx_t ZSTDFinalAnalyze(AnalyzeState &state_p) {
+	auto &state = state_p.Cast<ZSTDAnalyzeState>();
+	// the compressed size is not known without compressing the data: estimate with the decompressed size
+	auto frame_count = (state.count + ZSTD_FRAME_SIZE - 1) / ZSTD_FRAME_SIZE;
+	return state.total_string_size + state.count * sizeof(uint32_t) +
+	       frame_count * (ZSTD_FRAME_HEADER_SIZE + ZSTD_METADATA_SIZE);
+}
+
+//===--------------------------------------------------------------------===//
+// Compress
+//===--------------------------------------------------------------------===//
+struct ZSTDCompressState : public CompressionState {
+	ZSTDCompressState(ColumnDataCheckpointer &checkpointer_p, const CompressionInfo &info)
+	    : CompressionState(info), checkpointer(checkpointer_p),
+	      function(checkpointer.GetCompressionFunction(CompressionType::COMPRESSION_ZSTD)),
+	      frame_limit(ZSTDFrameLimit(info.GetBlockSize())), frame_data(make_unsafe_uniq_array<data_t>(frame_limit)),
+	      compressed_limit(duckdb_zstd::ZSTD_compressBound(frame_limit)),
+	      compressed_data(make_unsafe_uniq_array<data_t>(compressed_limit)) {
+		context = duckdb_zstd::ZSTD_createCCtx();
+		if (!context) {
+			throw InternalException("Failed to create zstd compression context");
+		}
+		CreateEmptySegment(checkpointer.GetRowGroup().start);
+	}
+	~ZSTDCompressState() override {
+		duckdb_zstd::ZSTD_freeCCtx(context);
+	}
+
+	ColumnDataCheckpointer &checkpointer;
+	CompressionFunction &function;
+	unique_ptr<ColumnSegment> current_segment;
+	BufferHandle handle;
+	data_ptr_t data_ptr;
+	data_ptr_t metadata_ptr;
+	idx_t frame_count;
+
+	duckdb_zstd::ZSTD_CCtx *context;
+	//! The rows of the frame that is currently being built
+	idx_t count = 0;
+	uint32_t lengths[ZSTD_FRAME_SIZE];
+	bool validity[ZSTD_FRAME_SIZE];
+	//! The string data of the frame that is currently being built
+	idx_t frame_limit;
+	unsafe_unique_array<data_t> frame_data;
+	idx_t frame_size = 0;
+	idx_t compressed_limit;
+	unsafe_unique_array<data_t> compressed_data;
+
+public:
+	void CreateEmptySegment(idx_t row_start) {
+		auto &db = checkpointer.GetDatabase();
+		auto &type = checkpointer.GetType();
+
+		current_segment = ColumnSegment::CreateTransientSegment(db, type, row_start);
+		current_segment->function = function;
+
+		auto &buffer_manager = BufferManager::GetBufferManager(db);
+		handle = buffer_manager.Pin(current_segment->block);
+
+		data_ptr = handle.Ptr() + ZSTD_HEADER_SIZE;
+		metadata_ptr = handle.Ptr() + info.GetBlockSize();
+		frame_count = 0;
+	}
+
+	bool CanStore(idx_t data_bytes) {
+		auto required = AlignValue<idx_t>(NumericCast<idx_t>(data_ptr - handle.Ptr()) + data_bytes) +
+		                NumericCast<idx_t>(handle.Ptr() + info.GetBlockSize() - metadata_ptr) + ZSTD_METADATA_SIZE;
+		return required <= info.GetBlockSize();
+	}
+
+	void Append(UnifiedVectorFormat &vdata, idx_t append_count) {
+		auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+		for (idx_t i = 0; i < append_count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			auto is_valid = vdata.validity.RowIsValid(idx);
+			auto string_size = is_valid ? data[idx].GetSize() : 0;
+			if (sizeof(uint32_t) * (count + 1) + frame_size + string_size > frame_limit) {
+				FlushFrame();
+			}
+			if (string_size > 0) {
+				memcpy(frame_data.get() + frame_size, data[idx].GetData(), string_size);
+				frame_size += string_size;
+			}
+			lengths[count] = NumericCast<uint32_t>(string_size);
+			validity[count] = is_valid;
+			count++;
+			if (count == ZSTD_FRAME_SIZE) {
+				FlushFrame();
+			}
+		}
+	}
+
+	void FlushFrame() {
+		if (count == 0) {
+			return;
+		}
+		// move the string data behind the lengths
+		auto lengths_size = count * sizeof(uint32_t);
+		memmove(frame_data.get() + lengths_size, frame_data.get(), frame_size);
+		memcpy(frame_data.get(), lengths, lengths_size);
+		auto decompressed_size = lengths_size + frame_size;
+
+		auto compressed_size = duckdb_zstd::ZSTD_compressCCtx(context, compressed_data.get(), compressed_limit,
+		                                                      frame_data.get(), decompressed_size, ZSTD_CLEVEL_DEFAULT);
+		if (duckdb_zstd::ZSTD_isError(compressed_size)) {
+			throw InternalException("Failed to compress zstd frame: %s",
+			                        duckdb_zstd::ZSTD_getErrorName(compressed_size));
+		}
+		if (!CanStore(ZSTD_FRAME_HEADER_SIZE + compressed_size)) {
+			auto row_start = current_segment->start + current_segment->count;
+			FlushSegment();
+			CreateEmptySegment(row_start);
+		}
+		D_ASSERT(CanStore(ZSTD_FRAME_HEADER_SIZE + compressed_size));
+
+		metadata_ptr -= ZSTD_METADATA_SIZE;
+		Store<uint32_t>(NumericCast<uint32_t>(current_segment->count.load()), metadata_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(data_ptr - handle.Ptr()), metadata_ptr + sizeof(uint32_t));
+
+		Store<uint32_t>(NumericCast<uint32_t>(compressed_size), data_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(decompressed_size), data_ptr + sizeof(uint32_t));
+		memcpy(data_ptr + ZSTD_FRAME_HEADER_SIZE, compressed_data.get(), compressed_size);
+		data_ptr += ZSTD_FRAME_HEADER_SIZE + compressed_size;
+
+		// update the statistics of the segment the frame ended up in
+		auto string_ptr = char_ptr_cast(frame_data.get() + lengths_size);
+		for (idx_t i = 0; i < count; i++) {
+			if (validity[i]) {
+				UncompressedStringStorage::UpdateStringStats(current_segment->stats, string_t(string_ptr, lengths[i]));
+			}
+			string_ptr += lengths[i];
+		}
+
+		current_segment->count += count;
+		frame_count++;
+		count = 0;
+		frame_size = 0;
+	}
+
+	void FlushSegment() {
+		auto &checkpoint_state = checkpointer.GetCheckpointState();
+		auto base_ptr = handle.Ptr();
+
+		// compact the segment by moving the metadata next to the data
+		auto unaligned_offset = NumericCast<idx_t>(data_ptr - base_ptr);
+		auto metadata_offset = AlignValue(unaligned_offset);
+		auto metadata_size = NumericCast<idx_t>(base_ptr + info.GetBlockSize() - metadata_ptr);
+		auto total_segment_size = metadata_offset + metadata_size;
+		if (unaligned_offset != metadata_offset) {
+			memset(base_ptr + unaligned_offset, 0, metadata_offset - unaligned_offset);
+		}
+		memmove(base_ptr + metadata_offset, metadata_ptr, metadata_size);
+		Store<uint32_t>(NumericCast<uint32_t>(total_segment_size), base_ptr);
+		Store<uint32_t>(NumericCast<uint32_t>(frame_count), base_ptr + sizeof(uint32_t));
+		handle.Destroy();
+
+		checkpoint_state.FlushSegment(std::move(current_segment), total_segment_size);
+	}
+
+	void Finalize() {
+		FlushFrame();
+		FlushSegment();
+		current_segment.reset();
+	}
+};
+
+unique_ptr<CompressionState> ZSTDInitCompression(ColumnDataCheckpointer &checkpointer,
+                                                 unique_ptr<AnalyzeState> state) {
+	return make_uniq<ZSTDCompressState>(checkpointer, state->info);
+}
+
+void ZSTDCompress(CompressionState &state_p, Vector &scan_vector, idx_t count) {
+	auto &state = state_p.Cast<ZSTDCompressState>();
+	UnifiedVectorFormat vdata;
+	scan_vector.ToUnifiedFormat(count, vdata);
+	state.Append(vdata, count);
+}
+
+void ZSTDFinalizeCompress(CompressionState &state_p) {
+	auto &state = state_p.Cast<ZSTDCompressState>();
+	state.Finalize();
+}
+
+//===--------------------------------------------------------------------===//
+// Scan
+//===--------------------------------------------------------------------===//
+struct ZSTDScanState : public SegmentScanState {
+	explicit ZSTDScanState(ColumnSegment &segment_p)
+	    : segment(segment_p), frame_data(make_unsafe_uniq_array<data_t>(
+	                              ZSTDFrameLimit(segment.GetBlockManager().GetBlockSize()))) {
+		auto &buffer_manager = BufferManager::GetBufferManager(segment.db);
+		handle = buffer_manager.Pin(segment.block);
+		base_ptr = handle.Ptr() + segment.GetBlockOffset();
+		metadata_end = base_ptr + Load<uint32_t>(base_ptr);
+		frame_count = Load<uint32_t>(base_ptr + sizeof(uint32_t));
+		context = duckdb_zstd::ZSTD_createDCtx();
+		if (!context) {
+			throw InternalException("Failed to create zstd decompression context");
+		}
+	}
+	~ZSTDScanState() override {
+		duckdb_zstd::ZSTD_freeDCtx(context);
+	}
+
+	ColumnSegment &segment;
+	BufferHandle handle;
+	data_ptr_t base_ptr;
+	data_ptr_t metadata_end;
+	idx_t frame_count;
+	duckdb_zstd::ZSTD_DCtx *context;
+
+	//! The frame that is currently decompressed into the frame data
+	idx_t decoded_frame = DConstants::INVALID_INDEX;
+	idx_t frame_start = 0;
+	idx_t frame_end = 0;
+	unsafe_unique_array<data_t> frame_data;
+	//! The offsets of the strings of the decoded frame within the frame data
+	uint32_t string_offsets[ZSTD_FRAME_SIZE + 1];
+
+public:
+	idx_t FrameStart(idx_t frame_idx) {
+		if (frame_idx >= frame_count) {
+			return segment.count;
+		}
+		return Load<uint32_t>(metadata_end - (frame_idx + 1) * ZSTD_METADATA_SIZE);
+	}
+
+	idx_t FindFrame(idx_t row) {
+		if (decoded_frame != DConstants::INVALID_INDEX && row >= frame_start) {
+			// scans mostly continue in the current or the next frame
+			if (row < frame_end) {
+				return decoded_frame;
+			}
+			if (row < FrameStart(decoded_frame + 2)) {
+				return decoded_frame + 1;
+			}
+		}
+		// binary search for the last frame that starts at or before the row
+		idx_t lower = 0;
+		idx_t upper = frame_count;
+		while (upper - lower > 1) {
+			auto middle = lower + (upper - lower) / 2;
+			if (FrameStart(middle) <= row) {
+				lower = middle;
+			} else {
+				upper = middle;
+			}
+		}
+		return lower;
+	}
+
+	void LoadFrame(idx_t frame_idx) {
+		if (frame_idx == decoded_frame) {
+			return;
+		}
+		auto frame_offset = Load<uint32_t>(metadata_end - (frame_idx + 1) * ZSTD_METADATA_SIZE + sizeof(uint32_t));
+		auto frame_ptr = base_ptr + frame_offset;
+		auto compressed_size = Load<uint32_t>(frame_ptr);
+		auto decompressed_size = Load<uint32_t>(frame_ptr + sizeof(uint32_t));
+
+		auto result = duckdb_zstd::ZSTD_decompressDCtx(context, frame_data.get(), decompressed_size,
+		                                               frame_ptr + ZSTD_FRAME_HEADER_SIZE, compressed_size);
+		if (duckdb_zstd::ZSTD_isError(result) || result != decompressed_size) {
+			throw IOException("Failed to decompress zstd frame: %s", duckdb_zstd::ZSTD_getErrorName(result));
+		}
+		frame_start = FrameStart(frame_idx);
+		frame_end = FrameStart(frame_idx + 1);
+		decoded_frame = frame_idx;
+
+		auto count = frame_end - frame_start;
+		auto offset = NumericCast<uint32_t>(count * sizeof(uint32_t));
+		for (idx_t i = 0; i < count; i++) {
+			string_offsets[i] = offset;
+			offset += Load<uint32_t>(frame_data.get() + i * sizeof(uint32_t));
+		}
+		string_offsets[count] = offset;
+	}
+
+	string_t FetchString(Vector &result, idx_t row) {
+		LoadFrame(FindFrame(row));
+		auto idx = row - frame_start;
+		auto string_size = string_offsets[idx + 1] - string_offsets[idx];
+		return StringVector::AddStringOrBlob(result, char_ptr_cast(frame_data.get() + string_offsets[idx]),
+		                                     string_size);
+	}
+};
+
+unique_ptr<SegmentScanState> ZSTDInitScan(ColumnSegment &segment) {
+	return make_uniq<ZSTDScanState>(segment);
+}
+
+void ZSTDScanPartial(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result,
+                     idx_t result_offset) {
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < scan_count; i++) {
+		result_data[result_offset + i] = scan_state.FetchString(result, start + i);
+	}
+}
+
+void ZSTDScan(ColumnSegment &segment, ColumnScanState &state, idx_t scan_count, Vector &result) {
+	ZSTDScanPartial(segment, state, scan_count, result, 0);
+}
+
+//===--------------------------------------------------------------------===//
+// Select
+//===--------------------------------------------------------------------===//
+void ZSTDSelect(ColumnSegment &segment, ColumnScanState &state, idx_t vector_count, Vector &result,
+                const SelectionVector &sel, idx_t sel_count) {
+	// only the frames that contain selected rows are decompressed
+	auto &scan_state = state.scan_state->Cast<ZSTDScanState>();
+	auto start = segment.GetRelativeIndex(state.row_index);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	for (idx_t i = 0; i < sel_count; i++) {
+		result_data[i] = scan_state.FetchString(result, start + sel.get_index(i));
+	}
+}
+
+//===--------------------------------------------------------------------===//
+// Fetch
+//===--------------------------------------------------------------------===//
+void ZSTDFetchRow(ColumnSegment &segment, ColumnFetchState &state, row_t row_id, Vector &result, idx_t result_idx) {
+	// only the frame containing the row is decompressed
+	ZSTDScanState scan_state(segment);
+	auto result_data = FlatVector::GetData<string_t>(result);
+	result_data[result_idx] = scan_state.FetchString(result, NumericCast<idx_t>(row_id));
+}
+
+//===--------------------------------------------------------------------===//
+// Get Function
+//===--------------------------------------------------------------------===//
+CompressionFunction ZSTDFun::GetFunction(PhysicalType data_type) {
+	D_ASSERT(data_type == PhysicalType::VARCHAR);
+	CompressionFunction function(CompressionType::COMPRESSION_ZSTD, data_type, ZSTDInitAnalyze, ZSTDAnalyze,
+	                             ZSTDFinalAnalyze, ZSTDInitCompression, ZSTDCompress, ZSTDFinalizeCompress,
+	                             ZSTDInitScan, ZSTDScan, ZSTDScanPartial, ZSTDFetchRow,
+	                             UncompressedFunctions::EmptySkip);
+	function.select = ZSTDSelect;
+	return function;
+}
+
+bool ZSTDFun::TypeIsSupported(const CompressionInfo &info) {
+	return info.GetPhysicalType() == PhysicalType::VARCHAR;
+}
+
+} // namespace duckdb
@@ -309,6 +309,10 @@ void DataTable::AddIndex(unique_ptr<Index> index) {
 	info->indexes.AddIndex(std::move(index));
 }
 
+idx_t DataTable::BuildBloomFilters(const vector<column_t> &column_ids) {
+	return row_groups->BuildBloomFilters(column_ids);
+}
+
 bool DataTable::HasForeignKeyIndex(const vector<PhysicalIndex> &keys, ForeignKeyType type) {
 	return info->indexes.FindForeignKeyIndex(keys, type) != nullptr;
 }
@@ -1,5 +1,6 @@
 #include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/hash_index.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -36,6 +37,20 @@ LocalTableStorage::LocalTableStorage(ClientContext &context, DataTable &table)
 		}
 		return false;
 	});
+	data_table_info->GetIndexes().BindAndScan<HashIndex>(context, *data_table_info, [&](HashIndex &hash_index) {
+		if (hash_index.GetConstraintType() != IndexConstraintType::NONE) {
+			// unique index: create a local hash index that maintains the same unique constraint
+			vector<unique_ptr<Expression>> unbound_expressions;
+			unbound_expressions.reserve(hash_index.unbound_expressions.size());
+			for (auto &expr : hash_index.unbound_expressions) {
+				unbound_expressions.push_back(expr->Copy());
+			}
+			indexes.AddIndex(make_uniq<HashIndex>(hash_index.GetIndexName(), hash_index.GetConstraintType(),
+			                                      hash_index.GetColumnIds(), hash_index.table_io_manager,
+			                                      std::move(unbound_expressions), hash_index.db));
+		}
+		return false;
+	});
 }
 
 LocalTableStorage::LocalTableStorage(ClientContext &context, DataTable &new_dt, LocalTableStorage &parent,
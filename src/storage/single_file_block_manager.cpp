@@ -457,7 +457,32 @@ void SingleFileBlockManager::ReadBlocks(FileBuffer &buffer, block_id_t start_blo
 	// read the buffer from disk
 	auto location = GetBlockLocation(start_block);
 	buffer.Read(*handle, location);
+	VerifyBlockChecksums(buffer, location, block_count);
+}
+
+bool SingleFileBlockManager::SupportsBatchedReads() {
+	return DBConfig::Get(db).options.enable_io_uring && !IsRemote();
+}
+
+void SingleFileBlockManager::ReadBlockRuns(vector<BlockReadRun> &runs) {
+	if (!SupportsBatchedReads()) {
+		BlockManager::ReadBlockRuns(runs);
+		return;
+	}
+	vector<FileReadRequest> requests;
+	for (auto &run : runs) {
+		D_ASSERT(run.start_block >= 0);
+		auto &buffer = run.buffer.get();
+		requests.emplace_back(buffer.InternalBuffer(), NumericCast<int64_t>(buffer.AllocSize()),
+		                      GetBlockLocation(run.start_block));
+	}
+	handle->file_system.ReadBatch(*handle, requests);
+	for (auto &run : runs) {
+		VerifyBlockChecksums(run.buffer.get(), GetBlockLocation(run.start_block), run.block_count);
+	}
+}
 
+void SingleFileBlockManager::VerifyBlockChecksums(FileBuffer &buffer, idx_t location, idx_t block_count) {
 	// for each of the blocks - verify the checksum
 	auto ptr = buffer.InternalBuffer();
 	for (idx_t i = 0; i < block_count; i++) {
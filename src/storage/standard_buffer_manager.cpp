@@ -212,7 +212,45 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 	auto intermediate_buffer = Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize());
 	// perform a batch read of the blocks into the buffer
 	block_manager.ReadBlocks(intermediate_buffer.GetFileBuffer(), first_block, block_count);
+	LoadBlocksFromBuffer(handles, load_map, first_block, block_count, intermediate_buffer);
+}
+
+void StandardBufferManager::BatchReadRuns(vector<shared_ptr<BlockHandle>> &handles,
+                                          const map<block_id_t, idx_t> &load_map,
+                                          const vector<pair<block_id_t, block_id_t>> &runs) {
+	auto &block_manager = handles[0]->block_manager;
+	idx_t run_idx = 0;
+	while (run_idx < runs.size()) {
+		// allocate the intermediate buffers of the next batch of runs, including runs of a single block
+		// the batches are bounded, so the blocks are not held in memory twice all at once
+		vector<BufferHandle> intermediate_buffers;
+		vector<BlockReadRun> read_runs;
+		idx_t batch_block_count = 0;
+		for (; run_idx < runs.size(); run_idx++) {
+			auto &run = runs[run_idx];
+			idx_t block_count = NumericCast<idx_t>(run.second - run.first + 1);
+			if (!read_runs.empty() && batch_block_count + block_count > BATCH_READ_MAXIMUM_BLOCKS) {
+				break;
+			}
+			intermediate_buffers.push_back(Allocate(MemoryTag::BASE_TABLE, block_count * block_manager.GetBlockSize()));
+			read_runs.emplace_back(intermediate_buffers.back().GetFileBuffer(), run.first, block_count);
+			batch_block_count += block_count;
+		}
+		// issue all reads of the batch at once
+		block_manager.ReadBlockRuns(read_runs);
 
+		for (idx_t batch_idx = 0; batch_idx < read_runs.size(); batch_idx++) {
+			auto &read_run = read_runs[batch_idx];
+			LoadBlocksFromBuffer(handles, load_map, read_run.start_block, read_run.block_count,
+			                     intermediate_buffers[batch_idx]);
+		}
+	}
+}
+
+void StandardBufferManager::LoadBlocksFromBuffer(vector<shared_ptr<BlockHandle>> &handles,
+                                                 const map<block_id_t, idx_t> &load_map, block_id_t first_block,
+                                                 idx_t block_count, BufferHandle &intermediate_buffer) {
+	auto &block_manager = handles[0]->block_manager;
 	// the blocks are read - now we need to assign them to the individual blocks
 	for (idx_t block_idx = 0; block_idx < block_count; block_idx++) {
 		block_id_t block_id = first_block + NumericCast<block_id_t>(block_idx);
@@ -261,7 +299,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
+	// iterate over the blocks and gather the runs of adjacent blocks
+	vector<pair<block_id_t, block_id_t>> runs;
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
@@ -273,17 +312,26 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			// this block is adjacent to the previous block - add it to the batch read
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - close the previous run
+			runs.emplace_back(first_block, previous_block_id);
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	runs.emplace_back(first_block, previous_block_id);
+
+	auto &block_manager = handles[0]->block_manager;
+	if (block_manager.SupportsBatchedReads()) {
+		// the block manager can submit all runs at once
+		BatchReadRuns(handles, to_be_loaded, runs);
+		return;
+	}
+	// perform a bulk read per run
+	for (auto &run : runs) {
+		BatchRead(handles, to_be_loaded, run.first, run.second);
+	}
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -408,6 +456,8 @@ vector<MemoryInformation> StandardBufferManager::GetMemoryUsageInfo() const {
 		info.tag = MemoryTag(k);
 		info.size = buffer_pool.memory_usage_per_tag[k].load();
 		info.evicted_data = evicted_data_per_tag[k].load();
+		info.evicted_blocks = buffer_pool.evicted_blocks_per_tag[k].load();
+		info.protected_blocks = buffer_pool.protected_blocks_per_tag[k].load();
 		result.push_back(info);
 	}
 	return result;
@@ -547,6 +597,8 @@ vector<TemporaryFileInformation> StandardBufferManager::GetTemporaryFiles() {
 		TemporaryFileInformation info;
 		info.path = name;
 		info.size = NumericCast<idx_t>(fs.GetFileSize(*handle));
+		info.block_size = info.size;
+		info.bytes_saved = 0;
 		handle.reset();
 		result.push_back(info);
 	});
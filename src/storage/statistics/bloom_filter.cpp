@@ -0,0 +1,131 @@
+#include "duckdb/storage/statistics/bloom_filter.hpp"
+
+#include "duckdb/common/serializer/deserializer.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(idx_t row_count)
+    : BloomFilter(row_count, vector<uint64_t>(WordCount(row_count), 0)) {
+}
+
+BloomFilter::BloomFilter(idx_t row_count_p, vector<uint64_t> words_p)
+    : row_count(row_count_p), words(std::move(words_p)) {
+	D_ASSERT(!words.empty() && IsPowerOfTwo(words.size()));
+	mask = words.size() - 1;
+}
+
+idx_t BloomFilter::WordCount(idx_t row_count) {
+	auto bit_count = MaxValue<idx_t>(row_count, 1) * BLOOM_FILTER_BITS_PER_VALUE;
+	return NextPowerOfTwo((bit_count + 63) / 64);
+}
+
+void BloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		words[hashes[i] & mask] |= GetBits(hashes[i]);
+	}
+}
+
+void BloomFilter::Insert(Vector &input, idx_t count) {
+	Vector hashes(LogicalType::HASH, count);
+	VectorOperations::Hash(input, hashes, count);
+	hashes.Flatten(count);
+	auto hash_data = FlatVector::GetData<hash_t>(hashes);
+
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	if (vdata.validity.AllValid()) {
+		Insert(hash_data, count);
+		return;
+	}
+	for (idx_t i = 0; i < count; i++) {
+		if (vdata.validity.RowIsValid(vdata.sel->get_index(i))) {
+			words[hash_data[i] & mask] |= GetBits(hash_data[i]);
+		}
+	}
+}
+
+bool BloomFilter::MightContain(const Value &value) const {
+	D_ASSERT(!value.IsNull());
+	Vector input(value);
+	Vector hashes(LogicalType::HASH, 1);
+	VectorOperations::Hash(input, hashes, 1);
+	hashes.Flatten(1);
+	return MightContainHash(FlatVector::GetData<hash_t>(hashes)[0]);
+}
+
+FilterPropagateResult BloomFilter::CheckFilter(const TableFilter &filter, const LogicalType &type) const {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL) {
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		auto &constant = constant_filter.constant;
+		if (constant.IsNull() || constant.type() != type) {
+			// the hash of the constant is only comparable if it has the type of the column
+			return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+		}
+		return MightContain(constant) ? FilterPropagateResult::NO_PRUNING_POSSIBLE
+		                              : FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction_and = filter.Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction_and.child_filters) {
+			if (CheckFilter(*child_filter, type) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+			}
+		}
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		// e.g. an IN list: none of the values may be contained
+		auto &conjunction_or = filter.Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction_or.child_filters) {
+			if (CheckFilter(*child_filter, type) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+				return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+			}
+		}
+		return FilterPropagateResult::FILTER_ALWAYS_FALSE;
+	}
+	default:
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+}
+
+bool BloomFilter::TypeIsSupported(const LogicalType &type) {
+	switch (type.InternalType()) {
+	case PhysicalType::STRUCT:
+	case PhysicalType::LIST:
+	case PhysicalType::ARRAY:
+		return false;
+	default:
+		return true;
+	}
+}
+
+void BloomFilter::Serialize(Serializer &serializer) const {
+	serializer.WriteProperty(100, "row_count", row_count);
+	serializer.WriteProperty<idx_t>(101, "word_count", words.size());
+	serializer.WriteProperty(102, "words", const_data_ptr_cast(words.data()), words.size() * sizeof(uint64_t));
+	serializer.WriteProperty<idx_t>(103, "hash_version", HASH_VERSION);
+}
+
+unique_ptr<BloomFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto row_count = deserializer.ReadProperty<idx_t>(100, "row_count");
+	auto word_count = deserializer.ReadProperty<idx_t>(101, "word_count");
+	vector<uint64_t> words(word_count);
+	deserializer.ReadProperty(102, "words", data_ptr_cast(words.data()), word_count * sizeof(uint64_t));
+	// filters without a hash version predate the versioning, and are treated like filters of an unknown version
+	auto hash_version = deserializer.ReadPropertyWithDefault<idx_t>(103, "hash_version", 0);
+	if (hash_version != HASH_VERSION) {
+		return nullptr;
+	}
+	return make_uniq<BloomFilter>(row_count, std::move(words));
+}
+
+} // namespace duckdb
@@ -223,7 +223,7 @@ void SingleFileStorageManager::LoadDatabase(const optional_idx block_alloc_size)
 
 ///////////////////////////////////////////////////////////////////////////////
 
-enum class WALCommitState { IN_PROGRESS, FLUSHED, TRUNCATED };
+enum class WALCommitState { IN_PROGRESS, FLUSHED, SYNCED, TRUNCATED };
 
 class SingleFileStorageCommitState : public StorageCommitState {
 public:
@@ -232,12 +232,15 @@ public:
 
 	//! Revert the commit
 	void RevertCommit() override;
-	// Make the commit persistent
+	// Write the commit to the WAL
 	void FlushCommit() override;
+	//! Wait until the commit is synced to disk
+	void SyncCommit() override;
 
 private:
 	idx_t initial_wal_size = 0;
 	idx_t initial_written = 0;
+	idx_t flush_id = 0;
 	WriteAheadLog &wal;
 	WALCommitState state;
 };
@@ -275,10 +278,18 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	flush_id = wal.WriteFlush();
 	state = WALCommitState::FLUSHED;
 }
 
+void SingleFileStorageCommitState::SyncCommit() {
+	if (state != WALCommitState::FLUSHED) {
+		return;
+	}
+	wal.SyncFlush(flush_id);
+	state = WALCommitState::SYNCED;
+}
+
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(WriteAheadLog &wal) {
 	return make_uniq<SingleFileStorageCommitState>(*this, wal);
 }
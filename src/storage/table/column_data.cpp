@@ -3,6 +3,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/compression/compressed_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
@@ -132,10 +133,7 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 }
 
-idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
-	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
-		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
-	}
+void ColumnData::BeginScanVector(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
 		D_ASSERT(state.current);
@@ -148,6 +146,13 @@ idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remai
 	if (state.internal_index < state.row_index) {
 		state.current->Skip(state);
 	}
+}
+
+idx_t ColumnData::ScanVector(ColumnScanState &state, Vector &result, idx_t remaining, ScanVectorType scan_type) {
+	if (scan_type == ScanVectorType::SCAN_FLAT_VECTOR && result.GetVectorType() != VectorType::FLAT_VECTOR) {
+		throw InternalException("ScanVector called with SCAN_FLAT_VECTOR but result is not a flat vector");
+	}
+	BeginScanVector(state);
 	D_ASSERT(state.current->type == type);
 	idx_t initial_remaining = remaining;
 	while (remaining > 0) {
@@ -302,6 +307,45 @@ void ColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnS
 	ColumnSegment::FilterSelection(sel, result, vdata, filter, scan_count, s_count);
 }
 
+bool ColumnData::FilterVector(ColumnScanState &state, Vector &result, idx_t target_count, SelectionVector &sel,
+                              idx_t &sel_count, const TableFilter &filter) {
+	if (!state.current || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	if (!state.current->SupportsFilter() || !CompressedFilter::CanFilter(filter)) {
+		return false;
+	}
+	if (GetVectorScanType(state, target_count) != ScanVectorType::SCAN_ENTIRE_VECTOR) {
+		// the vector has updates or crosses a segment boundary
+		return false;
+	}
+	BeginScanVector(state);
+	state.current->Filter(state, target_count, result, sel, sel_count, filter);
+	state.row_index += target_count;
+	state.internal_index = state.row_index;
+	return true;
+}
+
+bool ColumnData::CanSelectVector(ColumnScanState &state, idx_t target_count) {
+	if (!state.current || (state.scan_options && state.scan_options->force_fetch_row)) {
+		return false;
+	}
+	if (!state.current->SupportsSelect()) {
+		return false;
+	}
+	// the vector must not have updates or cross a segment boundary
+	return ColumnData::GetVectorScanType(state, target_count) == ScanVectorType::SCAN_ENTIRE_VECTOR;
+}
+
+void ColumnData::SelectVector(ColumnScanState &state, Vector &result, idx_t target_count, const SelectionVector &sel,
+                              idx_t sel_count) {
+	D_ASSERT(CanSelectVector(state, target_count));
+	BeginScanVector(state);
+	state.current->Select(state, target_count, result, sel, sel_count);
+	state.row_index += target_count;
+	state.internal_index = state.row_index;
+}
+
 void ColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
                             SelectionVector &sel, idx_t s_count) {
 	Scan(transaction, vector_index, state, result);
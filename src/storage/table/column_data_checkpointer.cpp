@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/function/compression/compression.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/parser/column_definition.hpp"
@@ -110,6 +111,24 @@ unique_ptr<AnalyzeState> ColumnDataCheckpointer::DetectBestCompressionMethod(idx
 	    config.options.force_compression != CompressionType::COMPRESSION_AUTO) {
 		forced_method = ForceCompression(compression_functions, config.options.force_compression);
 	}
+	if (forced_method != CompressionType::COMPRESSION_ZSTD) {
+		// zstd trades scan speed for size: it is only used when it is explicitly requested
+		for (auto &compression_function : compression_functions) {
+			if (compression_function && compression_function->type == CompressionType::COMPRESSION_ZSTD) {
+				compression_function = nullptr;
+			}
+		}
+	}
+	if (forced_method != CompressionType::COMPRESSION_PFOR_DELTA &&
+	    !config.options.serialization_compatibility.Compare(PForDeltaFun::SERIALIZATION_VERSION)) {
+		// older versions cannot read pfor-delta segments: it is only chosen automatically if the storage compatibility
+		// version allows it
+		for (auto &compression_function : compression_functions) {
+			if (compression_function && compression_function->type == CompressionType::COMPRESSION_PFOR_DELTA) {
+				compression_function = nullptr;
+			}
+		}
+	}
 	// set up the analyze states for each compression method
 	vector<unique_ptr<AnalyzeState>> analyze_states;
 	analyze_states.reserve(compression_functions.size());
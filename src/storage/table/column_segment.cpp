@@ -142,6 +142,26 @@ void ColumnSegment::ScanPartial(ColumnScanState &state, idx_t scan_count, Vector
 	function.get().scan_partial(*this, state, scan_count, result, result_offset);
 }
 
+bool ColumnSegment::SupportsFilter() const {
+	return function.get().filter != nullptr;
+}
+
+void ColumnSegment::Filter(ColumnScanState &state, idx_t vector_count, Vector &result, SelectionVector &sel,
+                           idx_t &sel_count, const TableFilter &filter) {
+	D_ASSERT(SupportsFilter());
+	function.get().filter(*this, state, vector_count, result, sel, sel_count, filter);
+}
+
+bool ColumnSegment::SupportsSelect() const {
+	return function.get().select != nullptr;
+}
+
+void ColumnSegment::Select(ColumnScanState &state, idx_t vector_count, Vector &result, const SelectionVector &sel,
+                           idx_t sel_count) {
+	D_ASSERT(SupportsSelect());
+	function.get().select(*this, state, vector_count, result, sel, sel_count);
+}
+
 //===--------------------------------------------------------------------===//
 // Fetch
 //===--------------------------------------------------------------------===//
@@ -20,18 +20,25 @@
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/storage/metadata/metadata_writer.hpp"
+#include "duckdb/storage/statistics/bloom_filter.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 
 namespace duckdb {
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, idx_t start, idx_t count)
-    : SegmentBase<RowGroup>(start, count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(start, count), collection(collection_p), allocation_size(0), has_bloom_filters(false),
+      bloom_filter_version(0) {
 	Verify();
 }
 
 RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
-    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), allocation_size(0) {
+    : SegmentBase<RowGroup>(pointer.row_start, pointer.tuple_count), collection(collection_p), allocation_size(0),
+      has_bloom_filters(false), bloom_filter_version(0) {
 	// deserialize the columns
 	if (pointer.data_pointers.size() != collection_p.GetTypes().size()) {
 		throw IOException("Row group column count is unaligned with table column count. Corrupt file?");
@@ -44,12 +51,25 @@ RowGroup::RowGroup(RowGroupCollection &collection_p, RowGroupPointer pointer)
 	}
 	this->deletes_pointers = std::move(pointer.deletes_pointers);
 	this->deletes_is_loaded = false;
+	if (!pointer.bloom_filter_pointers.empty()) {
+		// the Bloom filters are loaded lazily when they are first used
+		if (pointer.bloom_filter_pointers.size() != columns.size()) {
+			throw IOException("Row group Bloom filter count is unaligned with table column count. Corrupt file?");
+		}
+		this->bloom_filter_pointers = std::move(pointer.bloom_filter_pointers);
+		this->bloom_filters.resize(columns.size());
+		this->has_bloom_filters = true;
+	}
 
 	Verify();
 }
 
 void RowGroup::MoveToCollection(RowGroupCollection &collection_p, idx_t new_start) {
 	this->collection = collection_p;
+	if (new_start == start) {
+		// the row group has not moved - there is no need to load the columns to update their start
+		return;
+	}
 	this->start = new_start;
 	for (auto &column : GetColumns()) {
 		column->SetStart(new_start);
@@ -232,6 +252,25 @@ bool RowGroup::InitializeScan(CollectionScanState &state) {
 	return true;
 }
 
+bool RowGroup::InitializePrefetch(CollectionScanState &state, PrefetchState &prefetch_state) {
+	auto &column_ids = state.GetColumnIds();
+	auto filters = state.GetFilters();
+	if (filters && !CheckZonemap(*filters, column_ids)) {
+		return false;
+	}
+	for (auto &column : column_ids) {
+		if (column == COLUMN_IDENTIFIER_ROW_ID) {
+			continue;
+		}
+		auto &column_data = GetColumn(column);
+		ColumnScanState column_scan;
+		column_scan.Initialize(column_data.type, &state.GetOptions());
+		column_data.InitializeScan(column_scan);
+		column_data.InitializePrefetch(prefetch_state, column_scan, count);
+	}
+	return true;
+}
+
 unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, const LogicalType &target_type,
                                          idx_t changed_idx, ExpressionExecutor &executor,
                                          CollectionScanState &scan_state, DataChunk &scan_chunk) {
@@ -363,7 +402,14 @@ bool RowGroup::CheckZonemap(TableFilterSet &filters, const vector<storage_t> &co
 		auto column_index = entry.first;
 		auto &filter = entry.second;
 		const auto &base_column_index = column_ids[column_index];
-		if (!GetColumn(base_column_index).CheckZonemap(*filter)) {
+		auto &column = GetColumn(base_column_index);
+		if (!column.CheckZonemap(*filter)) {
+			return false;
+		}
+		auto bloom_filter = GetBloomFilter(base_column_index);
+		if (bloom_filter && !column.HasUpdates() &&
+		    bloom_filter->CheckFilter(*filter, column.type) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			// none of the values in the row group match the (equality) filter
 			return false;
 		}
 	}
@@ -486,9 +532,9 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 		}
 		auto &block_manager = GetBlockManager();
 #ifndef DUCKDB_ALTERNATIVE_VERIFY
-		// // in regular operation we only prefetch from remote file systems
+		// // in regular operation we only prefetch from remote file systems, or when reads can be batched
 		// // when alternative verify is set, we always prefetch for testing purposes
-		if (block_manager.IsRemote())
+		if (block_manager.IsRemote() || block_manager.SupportsBatchedReads())
 #else
 		if (!block_manager.InMemory())
 #endif
@@ -724,6 +770,7 @@ void RowGroup::AppendVersionInfo(TransactionData transaction, idx_t count) {
 	// create the version_info if it doesn't exist yet
 	auto &vinfo = GetOrCreateVersionInfo();
 	vinfo.AppendVersionInfo(transaction, count, row_group_start, row_group_end);
+	InvalidateBloomFilters();
 	this->count = row_group_end;
 }
 
@@ -739,6 +786,7 @@ void RowGroup::RevertAppend(idx_t row_group_start) {
 		column->RevertAppend(UnsafeNumericCast<row_t>(row_group_start));
 	}
 	this->count = MinValue<idx_t>(row_group_start - this->start, this->count);
+	InvalidateBloomFilters();
 	Verify();
 }
 
@@ -772,6 +820,7 @@ void RowGroup::Update(TransactionData transaction, DataChunk &update_chunk, row_
 		D_ASSERT(ids[i] >= row_t(this->start) && ids[i] < row_t(this->start + this->count));
 	}
 #endif
+	InvalidateBloomFilters();
 	for (idx_t i = 0; i < column_ids.size(); i++) {
 		auto column = column_ids[i];
 		D_ASSERT(column.index != COLUMN_IDENTIFIER_ROW_ID);
@@ -796,6 +845,7 @@ void RowGroup::UpdateColumn(TransactionData transaction, DataChunk &updates, Vec
 	auto primary_column_idx = column_path[0];
 	D_ASSERT(primary_column_idx != COLUMN_IDENTIFIER_ROW_ID);
 	D_ASSERT(primary_column_idx < columns.size());
+	InvalidateBloomFilters();
 	auto &col_data = GetColumn(primary_column_idx);
 	col_data.UpdateColumn(transaction, column_path, updates.data[0], ids, updates.size(), 1);
 	MergeStatistics(primary_column_idx, *col_data.GetUpdateStatistics());
@@ -834,6 +884,13 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriteInfo &info) {
 	// first sequentially, and the pointers are written later, so that the
 	// pointers all end up densely packed, and thus more cache-friendly.
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		if (IsColumnUnloaded(column_idx)) {
+			// the column has not been loaded since it was read from disk, so it cannot have changed
+			// its data and metadata are re-used as-is in Checkpoint
+			result.statistics.push_back(BaseStatistics::CreateEmpty(GetCollection().GetTypes()[column_idx]));
+			result.states.push_back(nullptr);
+			continue;
+		}
 		auto &column = GetColumn(column_idx);
 		ColumnCheckpointInfo checkpoint_info(info, column_idx);
 		auto checkpoint_state = column.Checkpoint(*this, checkpoint_info);
@@ -870,17 +927,25 @@ RowGroupWriteData RowGroup::WriteToDisk(RowGroupWriter &writer) {
 	vector<CompressionType> compression_types;
 	compression_types.reserve(columns.size());
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
+		if (IsColumnUnloaded(column_idx)) {
+			continue;
+		}
 		auto &column = GetColumn(column_idx);
 		if (column.count != this->count) {
 			throw InternalException("Corrupted in-memory column - column with index %llu has misaligned count (row "
 			                        "group has %llu rows, column has %llu)",
 			                        column_idx, this->count.load(), column.count.load());
 		}
-		compression_types.push_back(writer.GetColumnCompressionType(column_idx));
 	}
 
 	RowGroupWriteInfo info(writer.GetPartialBlockManager(), compression_types, writer.GetCheckpointType());
-	return WriteToDisk(info);
+	auto result = WriteToDisk(info);
+	// build the missing Bloom filters now, so they are written as part of the checkpoint
+	for (auto column_idx : GetBloomFilterColumns()) {
+		BuildBloomFilter(column_idx);
+	}
+	return result;
 }
 
 RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWriter &writer,
@@ -889,6 +954,10 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 
 	auto lock = global_stats.GetLock();
 	for (idx_t column_idx = 0; column_idx < GetColumnCount(); column_idx++) {
+		if (!write_data.states[column_idx]) {
+			// the statistics of re-used columns are already part of the global statistics
+			continue;
+		}
 		global_stats.GetStats(*lock, column_idx).Statistics().Merge(write_data.statistics[column_idx]);
 	}
 
@@ -896,7 +965,13 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 	D_ASSERT(write_data.states.size() == columns.size());
 	row_group_pointer.row_start = start;
 	row_group_pointer.tuple_count = count;
-	for (auto &state : write_data.states) {
+	for (idx_t column_idx = 0; column_idx < write_data.states.size(); column_idx++) {
+		auto &state = write_data.states[column_idx];
+		if (!state) {
+			// the column is unchanged since the last checkpoint: re-use its meta data
+			row_group_pointer.data_pointers.push_back(ReuseColumnPointer(column_idx));
+			continue;
+		}
 		// get the current position of the table data writer
 		auto &data_writer = writer.GetPayloadWriter();
 		auto pointer = data_writer.GetMetaBlockPointer();
@@ -914,10 +989,88 @@ RowGroupPointer RowGroup::Checkpoint(RowGroupWriteData write_data, RowGroupWrite
 		serializer.End();
 	}
 	row_group_pointer.deletes_pointers = CheckpointDeletes(writer.GetPayloadWriter().GetManager());
+	auto &config = DBConfig::GetConfig(GetCollection().GetAttached().GetDatabase());
+	if (config.options.serialization_compatibility.Compare(BloomIndex::SERIALIZATION_VERSION)) {
+		row_group_pointer.bloom_filter_pointers = CheckpointBloomFilters(writer.GetPayloadWriter());
+	} else {
+		// older versions cannot read the Bloom filters of a row group: they are not persisted
+		InvalidateBloomFilters();
+	}
 	Verify();
 	return row_group_pointer;
 }
 
+bool RowGroup::IsColumnUnloaded(storage_t c) const {
+	return is_loaded && !is_loaded[c];
+}
+
+//! Reads past the serialized data pointers of a column (and of its validity and child columns), following the
+//! layout written by ColumnCheckpointState::WriteDataPointers - no column data or segments are created
+static void SkipColumnDataPointers(Deserializer &deserializer, DatabaseInstance &db, const LogicalType &type) {
+	auto skip_data_pointers = [&]() {
+		// the segment states of the data pointers are deserialized with the type and compression info on the stack
+		auto pointer_type = type;
+		deserializer.Set<DatabaseInstance &>(db);
+		deserializer.Set<LogicalType &>(pointer_type);
+		CompressionInfo compression_info(Storage::BLOCK_SIZE, pointer_type.InternalType());
+		deserializer.Set<const CompressionInfo &>(compression_info);
+		vector<DataPointer> data_pointers;
+		deserializer.ReadProperty(100, "data_pointers", data_pointers);
+		deserializer.Unset<DatabaseInstance>();
+		deserializer.Unset<LogicalType>();
+		deserializer.Unset<const CompressionInfo>();
+	};
+	if (type.id() == LogicalTypeId::VALIDITY) {
+		skip_data_pointers();
+		return;
+	}
+	auto validity_type = LogicalType(LogicalTypeId::VALIDITY);
+	auto skip_validity = [&](Deserializer &source) { SkipColumnDataPointers(source, db, validity_type); };
+	switch (type.InternalType()) {
+	case PhysicalType::STRUCT: {
+		auto &child_types = StructType::GetChildTypes(type);
+		deserializer.ReadObject(101, "validity", skip_validity);
+		deserializer.ReadList(102, "sub_columns", [&](Deserializer::List &list, idx_t i) {
+			list.ReadObject([&](Deserializer &item) { SkipColumnDataPointers(item, db, child_types[i].second); });
+		});
+		break;
+	}
+	case PhysicalType::LIST:
+		skip_data_pointers();
+		deserializer.ReadObject(101, "validity", skip_validity);
+		deserializer.ReadObject(102, "child_column", [&](Deserializer &source) {
+			SkipColumnDataPointers(source, db, ListType::GetChildType(type));
+		});
+		break;
+	case PhysicalType::ARRAY:
+		deserializer.ReadObject(101, "validity", skip_validity);
+		deserializer.ReadObject(102, "child_column", [&](Deserializer &source) {
+			SkipColumnDataPointers(source, db, ArrayType::GetChildType(type));
+		});
+		break;
+	default:
+		skip_data_pointers();
+		deserializer.ReadObject(101, "validity", skip_validity);
+		break;
+	}
+}
+
+MetaBlockPointer RowGroup::ReuseColumnPointer(storage_t c) {
+	D_ASSERT(column_pointers.size() == columns.size());
+	// the meta data of the column can span multiple blocks - walk over it to find all of them
+	// all of these blocks have to be kept around after the checkpoint
+	auto &metadata_manager = GetCollection().GetMetadataManager();
+	auto &types = GetCollection().GetTypes();
+	vector<MetaBlockPointer> read_pointers;
+	MetadataReader column_data_reader(metadata_manager, column_pointers[c], &read_pointers);
+	BinaryDeserializer deserializer(column_data_reader);
+	deserializer.Begin();
+	SkipColumnDataPointers(deserializer, GetTableInfo().GetDB().GetDatabase(), types[c]);
+	deserializer.End();
+	metadata_manager.ClearModifiedBlocks(read_pointers);
+	return column_pointers[c];
+}
+
 vector<MetaBlockPointer> RowGroup::CheckpointDeletes(MetadataManager &manager) {
 	if (HasUnloadedDeletes()) {
 		// deletes were not loaded so they cannot be changed
@@ -932,11 +1085,178 @@ vector<MetaBlockPointer> RowGroup::CheckpointDeletes(MetadataManager &manager) {
 	return version_info->Checkpoint(manager);
 }
 
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+vector<storage_t> RowGroup::GetBloomFilterColumns() {
+	vector<storage_t> result;
+	GetTableInfo().GetIndexes().Scan([&](Index &index) {
+		if (index.GetIndexType() != BloomIndex::TYPE_NAME) {
+			return false;
+		}
+		for (auto &column_id : index.GetColumnIds()) {
+			if (std::find(result.begin(), result.end(), column_id) == result.end()) {
+				result.push_back(column_id);
+			}
+		}
+		return false;
+	});
+	return result;
+}
+
+shared_ptr<BloomFilter> RowGroup::ReadBloomFilter(MetaBlockPointer pointer,
+                                                  optional_ptr<vector<MetaBlockPointer>> read_pointers) {
+	MetadataReader reader(GetCollection().GetMetadataManager(), pointer, read_pointers);
+	BinaryDeserializer deserializer(reader);
+	deserializer.Begin();
+	shared_ptr<BloomFilter> result = BloomFilter::Deserialize(deserializer);
+	deserializer.End();
+	return result;
+}
+
+shared_ptr<BloomFilter> RowGroup::GetBloomFilter(storage_t c) {
+	if (!has_bloom_filters) {
+		return nullptr;
+	}
+	lock_guard<mutex> l(bloom_filter_lock);
+	if (bloom_filters.empty()) {
+		return nullptr;
+	}
+	D_ASSERT(c < bloom_filters.size());
+	if (!bloom_filters[c] && bloom_filter_pointers[c].IsValid()) {
+		bloom_filters[c] = ReadBloomFilter(bloom_filter_pointers[c]);
+		if (!bloom_filters[c]) {
+			// the filter was written with a different hash version: it is rebuilt in the next checkpoint
+			bloom_filter_pointers[c] = MetaBlockPointer();
+		}
+	}
+	auto &result = bloom_filters[c];
+	if (!result || result->GetRowCount() != count) {
+		// the filter does not cover all rows of the row group
+		return nullptr;
+	}
+	return result;
+}
+
+idx_t RowGroup::GetBloomFilterSize(storage_t c) {
+	lock_guard<mutex> l(bloom_filter_lock);
+	if (c >= bloom_filters.size() || !bloom_filters[c]) {
+		return 0;
+	}
+	return bloom_filters[c]->GetSizeInBytes();
+}
+
+void RowGroup::InvalidateBloomFilters() {
+	if (!has_bloom_filters) {
+		return;
+	}
+	lock_guard<mutex> l(bloom_filter_lock);
+	bloom_filters.clear();
+	bloom_filter_pointers.clear();
+	bloom_filter_version++;
+	has_bloom_filters = false;
+}
+
+void RowGroup::BuildBloomFilter(storage_t c) {
+	auto &type = GetCollection().GetTypes()[c];
+	if (!BloomFilter::TypeIsSupported(type) || GetBloomFilter(c)) {
+		return;
+	}
+	idx_t version;
+	{
+		lock_guard<mutex> l(bloom_filter_lock);
+		version = bloom_filter_version;
+	}
+	auto &column = GetColumn(c);
+	if (column.HasUpdates()) {
+		// the filter can only be built over the base data - it will be built in the next checkpoint instead
+		return;
+	}
+	auto row_count = count.load();
+	auto filter = make_shared_ptr<BloomFilter>(row_count);
+	ColumnScanState state;
+	state.Initialize(type, nullptr);
+	column.InitializeScan(state);
+	for (idx_t vector_idx = 0; vector_idx * STANDARD_VECTOR_SIZE < row_count; vector_idx++) {
+		auto scan_count = MinValue<idx_t>(row_count - vector_idx * STANDARD_VECTOR_SIZE, STANDARD_VECTOR_SIZE);
+		Vector scan_vector(type);
+		column.ScanCommitted(vector_idx, state, scan_vector, false, scan_count);
+		filter->Insert(scan_vector, scan_count);
+	}
+
+	lock_guard<mutex> l(bloom_filter_lock);
+	if (version != bloom_filter_version || row_count != count) {
+		// the row group was modified while the filter was being built
+		return;
+	}
+	if (bloom_filters.empty()) {
+		bloom_filters.resize(GetColumnCount());
+		bloom_filter_pointers.resize(GetColumnCount());
+	}
+	bloom_filters[c] = std::move(filter);
+	bloom_filter_pointers[c] = MetaBlockPointer();
+	has_bloom_filters = true;
+}
+
+vector<MetaBlockPointer> RowGroup::CheckpointBloomFilters(MetadataWriter &writer) {
+	auto bloom_columns = GetBloomFilterColumns();
+	vector<MetaBlockPointer> result;
+	lock_guard<mutex> l(bloom_filter_lock);
+	if (bloom_filters.empty()) {
+		return result;
+	}
+	result.resize(GetColumnCount());
+	for (auto column_idx : bloom_columns) {
+		if (bloom_filter_pointers[column_idx].IsValid()) {
+			vector<MetaBlockPointer> read_pointers;
+			auto filter = ReadBloomFilter(bloom_filter_pointers[column_idx], &read_pointers);
+			if (filter) {
+				// the filter is unchanged since the last checkpoint: re-use its meta data blocks
+				if (!bloom_filters[column_idx]) {
+					bloom_filters[column_idx] = std::move(filter);
+				}
+				writer.GetManager().ClearModifiedBlocks(read_pointers);
+				result[column_idx] = bloom_filter_pointers[column_idx];
+				continue;
+			}
+			// the filter was written with a different hash version: its meta data blocks are not re-used
+			bloom_filter_pointers[column_idx] = MetaBlockPointer();
+		}
+		auto &filter = bloom_filters[column_idx];
+		if (!filter || filter->GetRowCount() != count) {
+			continue;
+		}
+		auto pointer = writer.GetMetaBlockPointer();
+		BinarySerializer serializer(writer);
+		serializer.Begin();
+		filter->Serialize(serializer);
+		serializer.End();
+		result[column_idx] = pointer;
+	}
+	// the filters of columns whose Bloom filter index was dropped are not kept around
+	bool has_filters = false;
+	for (idx_t column_idx = 0; column_idx < result.size(); column_idx++) {
+		if (result[column_idx].IsValid()) {
+			has_filters = true;
+		} else {
+			bloom_filters[column_idx].reset();
+		}
+	}
+	if (!has_filters) {
+		bloom_filters.clear();
+		bloom_filter_pointers.clear();
+		return vector<MetaBlockPointer>();
+	}
+	bloom_filter_pointers = result;
+	return result;
+}
+
 void RowGroup::Serialize(RowGroupPointer &pointer, Serializer &serializer) {
 	serializer.WriteProperty(100, "row_start", pointer.row_start);
 	serializer.WriteProperty(101, "tuple_count", pointer.tuple_count);
 	serializer.WriteProperty(102, "data_pointers", pointer.data_pointers);
 	serializer.WriteProperty(103, "delete_pointers", pointer.deletes_pointers);
+	serializer.WritePropertyWithDefault(104, "bloom_filter_pointers", pointer.bloom_filter_pointers);
 }
 
 RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
@@ -945,6 +1265,8 @@ RowGroupPointer RowGroup::Deserialize(Deserializer &deserializer) {
 	result.tuple_count = deserializer.ReadProperty<uint64_t>(101, "tuple_count");
 	result.data_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(102, "data_pointers");
 	result.deletes_pointers = deserializer.ReadProperty<vector<MetaBlockPointer>>(103, "delete_pointers");
+	result.bloom_filter_pointers =
+	    deserializer.ReadPropertyWithDefault<vector<MetaBlockPointer>>(104, "bloom_filter_pointers");
 	return result;
 }
 
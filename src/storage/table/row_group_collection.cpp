@@ -14,6 +14,7 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
+#include "duckdb/execution/index/bloom_index.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 
 namespace duckdb {
@@ -169,6 +170,93 @@ void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &sta
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
 	state.processed_rows = 0;
+	state.prefetch_row = 0;
+	state.prefetch_depth = 1;
+	state.row_group_read_time = 0;
+	state.row_group_scan_time = 0;
+}
+
+constexpr const idx_t RowGroupCollection::MAX_PREFETCH_DEPTH;
+
+bool RowGroupCollection::ShouldPrefetch(ClientContext &context) {
+	return DBConfig::GetConfig(context).options.enable_scan_prefetch && !block_manager.InMemory();
+}
+
+//! Updates a moving average of a duration
+static void UpdateTimeAverage(double &average, double sample) {
+	average = average == 0 ? sample : 0.75 * average + 0.25 * sample;
+}
+
+void RowGroupCollection::PlanPrefetch(ParallelCollectionScanState &state, CollectionScanState &scan_state,
+                                      RowGroup &row_group, vector<reference<RowGroup>> &result) {
+	// the time since this thread started its previous row group is a sample of the time it takes to scan one
+	auto now = high_resolution_clock::now();
+	if (scan_state.row_group_scan_started) {
+		auto scan_time = duration_cast<std::chrono::microseconds>(now - scan_state.row_group_scan_start).count();
+		UpdateTimeAverage(state.row_group_scan_time, double(scan_time));
+	}
+	scan_state.row_group_scan_start = now;
+	scan_state.row_group_scan_started = true;
+
+	// gather the row groups from the current one up to prefetch_depth ahead that were not prefetched yet
+	optional_ptr<RowGroup> candidate = &row_group;
+	for (idx_t ahead = 0; candidate && ahead <= state.prefetch_depth; ahead++) {
+		if (candidate->start >= state.max_row) {
+			break;
+		}
+		if (candidate->start >= state.prefetch_row) {
+			result.push_back(*candidate);
+			state.prefetch_row = candidate->start + candidate->count;
+		}
+		candidate = row_groups->GetNextSegment(candidate.get());
+	}
+}
+
+void RowGroupCollection::PrefetchRowGroups(ParallelCollectionScanState &state, CollectionScanState &scan_state,
+                                           vector<reference<RowGroup>> &prefetch_row_groups) {
+	auto &buffer_manager = block_manager.buffer_manager;
+	auto block_size = block_manager.GetBlockAllocSize();
+	// do not let prefetched blocks take up more than a quarter of the free space in the buffer pool
+	auto max_memory = buffer_manager.GetMaxMemory();
+	auto used_memory = buffer_manager.GetUsedMemory();
+	auto headroom = max_memory > used_memory ? (max_memory - used_memory) / 4 : 0;
+
+	PrefetchState prefetch_state;
+	idx_t prefetched_row_groups = 0;
+	for (auto &row_group : prefetch_row_groups) {
+		auto block_count = prefetch_state.blocks.size();
+		if (!row_group.get().InitializePrefetch(scan_state, prefetch_state)) {
+			// skipped based on the zonemaps
+			continue;
+		}
+		if (prefetched_row_groups > 0 && prefetch_state.blocks.size() * block_size > headroom) {
+			// not enough headroom for this row group
+			prefetch_state.blocks.resize(block_count);
+			break;
+		}
+		prefetched_row_groups++;
+	}
+	// only blocks that are not yet loaded say something about the I/O latency
+	idx_t blocks_to_load = 0;
+	for (auto &block : prefetch_state.blocks) {
+		if (block->IsUnloaded()) {
+			blocks_to_load++;
+		}
+	}
+	if (blocks_to_load == 0) {
+		return;
+	}
+	auto start = high_resolution_clock::now();
+	buffer_manager.Prefetch(prefetch_state.blocks);
+	auto read_time = duration_cast<std::chrono::microseconds>(high_resolution_clock::now() - start).count();
+
+	// adapt the lookahead to the ratio between reading and scanning a row group
+	lock_guard<mutex> l(state.lock);
+	UpdateTimeAverage(state.row_group_read_time, double(read_time) / double(prefetched_row_groups));
+	if (state.row_group_scan_time > 0) {
+		auto depth = state.row_group_read_time / state.row_group_scan_time;
+		state.prefetch_depth = MinValue<idx_t>(MAX_PREFETCH_DEPTH, MaxValue<idx_t>(1, idx_t(depth) + 1));
+	}
 }
 
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
@@ -178,6 +266,7 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		idx_t max_row;
 		RowGroupCollection *collection;
 		RowGroup *row_group;
+		vector<reference<RowGroup>> prefetch_row_groups;
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
@@ -206,9 +295,15 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
+			if (collection->ShouldPrefetch(context)) {
+				collection->PlanPrefetch(state, scan_state, *row_group, prefetch_row_groups);
+			}
 		}
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
+		if (!prefetch_row_groups.empty()) {
+			collection->PrefetchRowGroups(state, scan_state, prefetch_row_groups);
+		}
 
 		// initialize the scan for this row group
 		bool need_to_scan = InitializeScanInRowGroup(scan_state, *collection, *row_group, vector_index, max_row);
@@ -990,6 +1085,7 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 
 	// no errors - finalize the row groups
 	idx_t new_total_rows = 0;
+	vector<idx_t> bloom_filter_sizes(types.size(), 0);
 	for (idx_t segment_idx = 0; segment_idx < segments.size(); segment_idx++) {
 		auto &entry = segments[segment_idx];
 		if (!entry.node) {
@@ -1004,10 +1100,43 @@ void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &gl
 		auto pointer =
 		    row_group.Checkpoint(std::move(checkpoint_state.write_data[segment_idx]), *row_group_writer, global_stats);
 		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
+		for (idx_t column_idx = 0; column_idx < types.size(); column_idx++) {
+			bloom_filter_sizes[column_idx] += row_group.GetBloomFilterSize(column_idx);
+		}
 		row_groups->AppendSegment(l, std::move(entry.node));
 		new_total_rows += row_group.count;
 	}
 	total_rows = new_total_rows;
+	// the Bloom filters were (re-)built or loaded as part of the checkpoint
+	SetBloomIndexSizes(bloom_filter_sizes);
+}
+
+//===--------------------------------------------------------------------===//
+// Bloom Filters
+//===--------------------------------------------------------------------===//
+idx_t RowGroupCollection::BuildBloomFilters(const vector<column_t> &column_ids) {
+	idx_t filter_size = 0;
+	for (auto &row_group : row_groups->Segments()) {
+		for (auto &column_id : column_ids) {
+			row_group.BuildBloomFilter(column_id);
+			filter_size += row_group.GetBloomFilterSize(column_id);
+		}
+	}
+	return filter_size;
+}
+
+void RowGroupCollection::SetBloomIndexSizes(const vector<idx_t> &column_filter_sizes) {
+	info->GetIndexes().Scan([&](Index &index) {
+		if (!index.IsBound() || index.GetIndexType() != BloomIndex::TYPE_NAME) {
+			return false;
+		}
+		idx_t filter_size = 0;
+		for (auto &column_id : index.GetColumnIds()) {
+			filter_size += column_filter_sizes[column_id];
+		}
+		index.Cast<BloomIndex>().SetInMemorySize(filter_size);
+		return false;
+	});
 }
 
 //===--------------------------------------------------------------------===//
@@ -72,7 +72,8 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), processed_rows(0), prefetch_row(0), prefetch_depth(1),
+      row_group_read_time(0), row_group_scan_time(0) {
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
@@ -4,6 +4,7 @@
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/storage/table/column_checkpoint_state.hpp"
 #include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
@@ -97,6 +98,39 @@ idx_t StandardColumnData::ScanCommitted(idx_t vector_index, ColumnScanState &sta
 	return scan_count;
 }
 
+void StandardColumnData::Select(TransactionData transaction, idx_t vector_index, ColumnScanState &state, Vector &result,
+                                SelectionVector &sel, idx_t &s_count, const TableFilter &filter) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	auto target_count = GetVectorCount(vector_index);
+	if (!FilterVector(state, result, target_count, sel, s_count, filter)) {
+		ColumnData::Select(transaction, vector_index, state, result, sel, s_count, filter);
+		return;
+	}
+	if (s_count == 0) {
+		// no rows passed the filter: we do not need to scan the validity
+		validity.Skip(state.child_states[0], target_count);
+		return;
+	}
+	// the filter was evaluated on the compressed values only: remove the rows that are NULL
+	validity.Scan(transaction, vector_index, state.child_states[0], result, target_count);
+	UnifiedVectorFormat vdata;
+	result.ToUnifiedFormat(target_count, vdata);
+	ColumnSegment::FilterSelection(sel, result, vdata, IsNotNullFilter(), target_count, s_count);
+}
+
+void StandardColumnData::FilterScan(TransactionData transaction, idx_t vector_index, ColumnScanState &state,
+                                    Vector &result, SelectionVector &sel, idx_t count) {
+	D_ASSERT(state.row_index == state.child_states[0].row_index);
+	auto target_count = GetVectorCount(vector_index);
+	if (!CanSelectVector(state, target_count) || !validity.CanSelectVector(state.child_states[0], target_count)) {
+		ColumnData::FilterScan(transaction, vector_index, state, result, sel, count);
+		return;
+	}
+	// only decompress the rows that passed the filters
+	SelectVector(state, result, target_count, sel, count);
+	validity.SelectVector(state.child_states[0], result, target_count, sel, count);
+}
+
 idx_t StandardColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t count) {
 	auto scan_count = ColumnData::ScanCount(state, result, count);
 	validity.ScanCount(state.child_states[0], result, count);
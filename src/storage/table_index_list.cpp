@@ -173,12 +173,12 @@ vector<IndexStorageInfo> TableIndexList::GetStorageInfos() {
 	for (auto &index : indexes) {
 		if (index->IsBound()) {
 			auto index_storage_info = index->Cast<BoundIndex>().GetStorageInfo(false);
-			D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
+			D_ASSERT(!index_storage_info.name.empty());
 			index_storage_infos.push_back(index_storage_info);
 		} else {
 			// TODO: Will/should this ever happen?
 			auto index_storage_info = index->Cast<UnboundIndex>().GetStorageInfo();
-			D_ASSERT(index_storage_info.IsValid() && !index_storage_info.name.empty());
+			D_ASSERT(!index_storage_info.name.empty());
 			index_storage_infos.push_back(index_storage_info);
 		}
 	}
@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t block_size)
+    : max_index(0), block_size(block_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), block_size(Storage::BLOCK_ALLOC_SIZE), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -57,8 +61,11 @@ bool BlockIndexManager::HasFreeBlocks() {
 	return !free_indexes.empty();
 }
 
+idx_t BlockIndexManager::GetUsedBlockCount() {
+	return indexes_in_use.size();
+}
+
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +73,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * block_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -95,10 +102,11 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 //===--------------------------------------------------------------------===//
 
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
-    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
+                                         idx_t index, idx_t slot_size, TemporaryFileManager &manager)
+    : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), slot_size(slot_size), db(db),
+      file_index(index),
       path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -119,14 +127,29 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 
 void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	D_ASSERT(slot_size == Storage::BLOCK_ALLOC_SIZE);
 	buffer.Write(*handle, GetPositionInFile(index.block_index));
 }
 
+void TemporaryFileHandle::WriteTemporaryFile(const_data_ptr_t compressed_data, TemporaryFileIndex index) {
+	D_ASSERT(slot_size < Storage::BLOCK_ALLOC_SIZE);
+	handle->Write(const_cast<data_ptr_t>(compressed_data), slot_size, GetPositionInFile(index.block_index));
+}
+
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the compressed slot and decompress it into the buffer
+	auto compressed = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed.get(), slot_size, GetPositionInFile(block_index));
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	TemporaryFileManager::DecompressBuffer(compressed.get(), *buffer);
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -154,6 +177,8 @@ TemporaryFileInformation TemporaryFileHandle::GetTemporaryFile() {
 	TemporaryFileInformation info;
 	info.path = path;
 	info.size = GetPositionInFile(index_manager.GetMaxIndex());
+	info.block_size = slot_size;
+	info.bytes_saved = index_manager.GetUsedBlockCount() * (Storage::BLOCK_ALLOC_SIZE - slot_size);
 	return info;
 }
 
@@ -180,7 +205,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -281,11 +306,22 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
+	// compress the block (if enabled) before writing it: this determines the size of the slot to write it to
+	AllocatedData compressed;
+	idx_t slot_size = Storage::BLOCK_ALLOC_SIZE;
+	auto compression = DBConfig::GetConfig(db).options.temp_file_compression;
+	if (compression != TemporaryCompression::NONE) {
+		slot_size = CompressBuffer(compression, buffer, compressed);
+	}
+
 	{
 		TemporaryManagerLock lock(manager_lock);
-		// first check if we can write to an open existing file
+		// first check if we can write to an open existing file with slots of the right size
 		for (auto &entry : files) {
 			auto &temp_file = entry.second;
+			if (temp_file->GetSlotSize() != slot_size) {
+				continue;
+			}
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
 				handle = entry.second.get();
@@ -295,7 +331,8 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
 			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file =
+			    make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, slot_size, *this);
 			handle = new_file.get();
 			files[new_file_index] = std::move(new_file);
 
@@ -306,7 +343,70 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	if (slot_size == Storage::BLOCK_ALLOC_SIZE) {
+		handle->WriteTemporaryFile(buffer, index);
+	} else {
+		handle->WriteTemporaryFile(compressed.get(), index);
+	}
+}
+
+//! Whether a block is worth compressing: compresses a few samples of the block, and checks if this would save at least
+//! a single slot
+static bool IsCompressible(const_data_ptr_t data, idx_t size) {
+	static constexpr idx_t SAMPLE_COUNT = 4;
+	static constexpr idx_t SAMPLE_SIZE = 4096;
+	char sample_buffer[SAMPLE_SIZE + SAMPLE_SIZE / 8 + 64];
+	D_ASSERT(idx_t(duckdb_lz4::LZ4_compressBound(SAMPLE_SIZE)) <= sizeof(sample_buffer));
+
+	idx_t compressed_size = 0;
+	for (idx_t sample_idx = 0; sample_idx < SAMPLE_COUNT; sample_idx++) {
+		auto offset = (size - SAMPLE_SIZE) / (SAMPLE_COUNT - 1) * sample_idx;
+		auto result = duckdb_lz4::LZ4_compress_default(const_char_ptr_cast(data + offset), sample_buffer,
+		                                                 int(SAMPLE_SIZE), int(sizeof(sample_buffer)));
+		compressed_size += result == 0 ? SAMPLE_SIZE : idx_t(result);
+	}
+	auto estimated_size = compressed_size * size / (SAMPLE_COUNT * SAMPLE_SIZE);
+	return estimated_size + TemporaryFileManager::TEMPORARY_SLOT_ALIGNMENT <= size;
+}
+
+idx_t TemporaryFileManager::CompressBuffer(TemporaryCompression compression, FileBuffer &buffer,
+                                           AllocatedData &compressed) {
+	auto data = buffer.InternalBuffer();
+	auto size = buffer.AllocSize();
+	if (compression == TemporaryCompression::ADAPTIVE && !IsCompressible(data, size)) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+
+	// the compressed block is prefixed with its size
+	auto bound = NumericCast<idx_t>(duckdb_lz4::LZ4_compressBound(NumericCast<int>(size)));
+	auto capacity = AlignValue<idx_t, TEMPORARY_SLOT_ALIGNMENT>(sizeof(idx_t) + bound);
+	compressed = Allocator::Get(db).Allocate(capacity);
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(data), char_ptr_cast(compressed.get() + sizeof(idx_t)), NumericCast<int>(size),
+	    NumericCast<int>(bound));
+	if (compressed_size <= 0) {
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	auto slot_size = AlignValue<idx_t, TEMPORARY_SLOT_ALIGNMENT>(sizeof(idx_t) + idx_t(compressed_size));
+	if (slot_size >= Storage::BLOCK_ALLOC_SIZE) {
+		// compression does not save any space on disk
+		return Storage::BLOCK_ALLOC_SIZE;
+	}
+	Store<idx_t>(idx_t(compressed_size), compressed.get());
+	auto end = sizeof(idx_t) + idx_t(compressed_size);
+	memset(compressed.get() + end, 0, slot_size - end);
+	return slot_size;
+}
+
+void TemporaryFileManager::DecompressBuffer(const_data_ptr_t compressed_data, FileBuffer &buffer) {
+	auto compressed_size = Load<idx_t>(compressed_data);
+	auto size = buffer.AllocSize();
+	auto result = duckdb_lz4::LZ4_decompress_safe(const_char_ptr_cast(compressed_data + sizeof(idx_t)),
+	                                              char_ptr_cast(buffer.InternalBuffer()),
+	                                              NumericCast<int>(compressed_size), NumericCast<int>(size));
+	if (result != NumericCast<int>(size)) {
+		throw IOException("Failed to decompress a block from the temporary directory");
+	}
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
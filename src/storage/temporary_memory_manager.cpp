@@ -6,9 +6,9 @@
 
 namespace duckdb {
 
-TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p,
+TemporaryMemoryState::TemporaryMemoryState(TemporaryMemoryManager &temporary_memory_manager_p, ClientContext &context_p,
                                            idx_t minimum_reservation_p)
-    : temporary_memory_manager(temporary_memory_manager_p), remaining_size(0),
+    : temporary_memory_manager(temporary_memory_manager_p), context(context_p), remaining_size(0),
       minimum_reservation(minimum_reservation_p), reservation(0) {
 }
 
@@ -59,9 +59,12 @@ unique_ptr<TemporaryMemoryState> TemporaryMemoryManager::Register(ClientContext
 	auto guard = Lock();
 	UpdateConfiguration(context);
 
+	auto client_memory_limit = GetClientMemoryLimit(context);
 	auto minimum_reservation = MinValue(num_threads * MINIMUM_RESERVATION_PER_STATE_PER_THREAD,
-	                                    memory_limit / MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
-	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, minimum_reservation));
+	                                    MinValue(memory_limit, client_memory_limit) /
+	                                        MINIMUM_RESERVATION_MEMORY_LIMIT_DIVISOR);
+	auto result = unique_ptr<TemporaryMemoryState>(new TemporaryMemoryState(*this, context, minimum_reservation));
+	client_usage[context].state_count++;
 	SetRemainingSize(*result, result->minimum_reservation);
 	SetReservation(*result, result->minimum_reservation);
 	active_states.insert(*result);
@@ -77,8 +80,12 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 		// We're forcing external processing. Give it the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
 	} else if (!has_temporary_directory) {
-		// We cannot offload, so we cannot limit memory usage. Set reservation equal to the remaining size
-		SetReservation(temporary_memory_state, temporary_memory_state.remaining_size);
+		// We cannot offload, so we cannot limit memory usage, except to the memory limit that is configured for the
+		// client. Set reservation equal to the remaining size, as far as the client limit allows
+		auto client_limit = GetClientMemoryLimit(temporary_memory_state.context);
+		auto client_free_memory = MaxValue<idx_t>(temporary_memory_state.minimum_reservation,
+		                                          GetClientFreeMemory(temporary_memory_state, client_limit));
+		SetReservation(temporary_memory_state, MinValue<idx_t>(temporary_memory_state.remaining_size, client_free_memory));
 	} else if (reservation - temporary_memory_state.reservation >= memory_limit) {
 		// We overshot. Set reservation equal to the minimum
 		SetReservation(temporary_memory_state, temporary_memory_state.minimum_reservation);
@@ -102,24 +109,66 @@ void TemporaryMemoryManager::UpdateState(ClientContext &context, TemporaryMemory
 			upper_bound = MinValue<idx_t>(upper_bound, NumericCast<idx_t>(ratio_of_remaining * memory_limit));
 		}
 
+		// Finally, the states of a client together cannot exceed:
+		// 4. The fair share of the client among all clients that currently have active states
+		// 5. The memory limit that is configured for the client
+		auto client_limit = MinValue<idx_t>(GetClientShare(temporary_memory_state),
+		                                    GetClientMemoryLimit(temporary_memory_state.context));
+		upper_bound = MinValue<idx_t>(upper_bound, GetClientFreeMemory(temporary_memory_state, client_limit));
+
 		SetReservation(temporary_memory_state, MaxValue<idx_t>(lower_bound, upper_bound));
 	}
 
 	Verify();
 }
 
+idx_t TemporaryMemoryManager::GetClientMemoryLimit(ClientContext &context) {
+	return ClientConfig::GetConfig(context).connection_operator_memory_limit;
+}
+
+idx_t TemporaryMemoryManager::GetClientFreeMemory(TemporaryMemoryState &temporary_memory_state,
+                                                  idx_t client_limit) const {
+	auto &client = client_usage.find(temporary_memory_state.context)->second;
+	auto client_other_reservation = client.reservation - temporary_memory_state.reservation;
+	return client_limit > client_other_reservation ? client_limit - client_other_reservation : 0;
+}
+
+idx_t TemporaryMemoryManager::GetClientShare(TemporaryMemoryState &temporary_memory_state) const {
+	if (client_usage.size() <= 1) {
+		// no other clients: the client can use everything
+		return memory_limit;
+	}
+	// every client is entitled to an equal share of the memory limit
+	auto fair_share = memory_limit / client_usage.size();
+	// memory that the other clients do not need is available to this client as well
+	idx_t other_demand = 0;
+	for (auto &entry : client_usage) {
+		if (RefersToSameObject(entry.first.get(), temporary_memory_state.context)) {
+			continue;
+		}
+		other_demand += MinValue<idx_t>(entry.second.remaining_size, fair_share);
+	}
+	return MaxValue<idx_t>(fair_share, memory_limit - MinValue<idx_t>(other_demand, memory_limit));
+}
+
 void TemporaryMemoryManager::SetRemainingSize(TemporaryMemoryState &temporary_memory_state, idx_t new_remaining_size) {
 	D_ASSERT(this->remaining_size >= temporary_memory_state.remaining_size);
+	auto &client = client_usage.find(temporary_memory_state.context)->second;
 	this->remaining_size -= temporary_memory_state.remaining_size;
+	client.remaining_size -= temporary_memory_state.remaining_size;
 	temporary_memory_state.remaining_size = new_remaining_size;
 	this->remaining_size += temporary_memory_state.remaining_size;
+	client.remaining_size += temporary_memory_state.remaining_size;
 }
 
 void TemporaryMemoryManager::SetReservation(TemporaryMemoryState &temporary_memory_state, idx_t new_reservation) {
 	D_ASSERT(this->reservation >= temporary_memory_state.reservation);
+	auto &client = client_usage.find(temporary_memory_state.context)->second;
 	this->reservation -= temporary_memory_state.reservation;
+	client.reservation -= temporary_memory_state.reservation;
 	temporary_memory_state.reservation = new_reservation;
 	this->reservation += temporary_memory_state.reservation;
+	client.reservation += temporary_memory_state.reservation;
 }
 
 void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_state) {
@@ -128,6 +177,10 @@ void TemporaryMemoryManager::Unregister(TemporaryMemoryState &temporary_memory_s
 	SetReservation(temporary_memory_state, 0);
 	SetRemainingSize(temporary_memory_state, 0);
 	active_states.erase(temporary_memory_state);
+	auto client_entry = client_usage.find(temporary_memory_state.context);
+	if (--client_entry->second.state_count == 0) {
+		client_usage.erase(client_entry);
+	}
 
 	Verify();
 }
@@ -142,6 +195,11 @@ void TemporaryMemoryManager::Verify() const {
 	}
 	D_ASSERT(total_reservation == this->reservation);
 	D_ASSERT(total_remaining_size == this->remaining_size);
+	idx_t total_client_reservation = 0;
+	for (auto &entry : client_usage) {
+		total_client_reservation += entry.second.reservation;
+	}
+	D_ASSERT(total_client_reservation == this->reservation);
 #endif
 }
 
@@ -6,17 +6,20 @@
 #include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/reference_map.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
+#include "duckdb/execution/task_error_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -25,12 +28,37 @@
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 #include "duckdb/storage/storage_manager.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/storage/write_ahead_log.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
+//! The inserts into a single table that have been read from the WAL, but have not been applied yet
+struct ReplayTableInserts {
+	explicit ReplayTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	reference<TableCatalogEntry> table;
+	vector<unique_ptr<DataChunk>> chunks;
+
+	void Apply(ClientContext &context) {
+		// append to the table in the order in which the chunks appear in the WAL
+		// we don't do any constraint verification here
+		auto &storage = table.get().GetStorage();
+		vector<unique_ptr<BoundConstraint>> bound_constraints;
+		LocalAppendState append_state;
+		storage.InitializeLocalAppend(append_state, table, context, bound_constraints);
+		for (auto &chunk : chunks) {
+			storage.LocalAppend(append_state, table, context, *chunk);
+		}
+		storage.FinalizeLocalAppend(append_state);
+	}
+};
+
 class ReplayState {
 public:
 	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
@@ -42,6 +70,33 @@ public:
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+	//! The number of transactions that were read completely, i.e., up to and including their flush marker
+	idx_t transaction_count = 0;
+	//! The number of complete transactions in the WAL - the transaction after them (if any) is torn
+	idx_t complete_transaction_count = 0;
+
+	//! The amount of pending rows after which the pending inserts are applied
+	static constexpr const idx_t MAX_PENDING_INSERT_ROWS = 8 * Storage::ROW_GROUP_SIZE;
+
+public:
+	//! Add an insert into the given table. Inserts are collected so that inserts into different tables can be
+	//! applied in parallel
+	void AddInsert(TableCatalogEntry &table, unique_ptr<DataChunk> chunk);
+	//! Apply all pending inserts. This has to be called before replaying any entry that can observe the contents of
+	//! the tables, so that entries are applied in WAL order
+	void ApplyInserts();
+	//! Whether the transaction that is currently replayed is complete in the WAL, i.e., it is not torn
+	bool TransactionIsComplete() const {
+		return transaction_count < complete_transaction_count;
+	}
+
+private:
+	//! The pending inserts, grouped per table
+	vector<unique_ptr<ReplayTableInserts>> pending_inserts;
+	//! Map of table -> index in pending_inserts
+	reference_map_t<TableCatalogEntry, idx_t> pending_insert_map;
+	//! The total amount of pending rows
+	idx_t pending_insert_rows = 0;
 };
 
 class WriteAheadLogDeserializer {
@@ -182,6 +237,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// read the current entry (deserialize only)
 			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
 			if (deserializer.ReplayEntry()) {
+				checkpoint_state.transaction_count++;
 				// check if the file is exhausted
 				if (reader.Finished()) {
 					// we finished reading the file: break
@@ -208,6 +264,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 
 	// we need to recover from the WAL: actually set up the replay state
 	ReplayState state(database, *con.context);
+	state.complete_transaction_count = checkpoint_state.transaction_count;
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
@@ -220,6 +277,12 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
+				// the inserts are collected across transactions, they are only applied before an entry that depends
+				// on them - or before we continue to a torn transaction, which is rolled back
+				state.transaction_count++;
+				if (!state.TransactionIsComplete()) {
+					state.ApplyInserts();
+				}
 				con.Commit();
 				// check if the file is exhausted
 				if (reader.Finished()) {
@@ -248,10 +311,139 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	return false;
 }
 
+//===--------------------------------------------------------------------===//
+// Replay Inserts
+//===--------------------------------------------------------------------===//
+struct ReplayInsertTaskState {
+	TaskErrorManager error_manager;
+	mutex lock;
+	std::condition_variable tasks_finished;
+	idx_t completed_tasks = 0;
+
+	void FinishTask() {
+		lock_guard<mutex> guard(lock);
+		completed_tasks++;
+		tasks_finished.notify_one();
+	}
+
+	//! Blocks until "task_count" tasks have finished
+	void WaitForTasks(idx_t task_count) {
+		std::unique_lock<mutex> guard(lock);
+		tasks_finished.wait(guard, [&]() { return completed_tasks == task_count; });
+	}
+};
+
+class ReplayInsertTask : public Task {
+public:
+	ReplayInsertTask(ReplayInsertTaskState &state, ClientContext &context, ReplayTableInserts &inserts)
+	    : state(state), context(context), inserts(inserts) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		auto result = TaskExecutionResult::TASK_FINISHED;
+		if (!state.error_manager.HasError()) {
+			try {
+				inserts.Apply(context);
+			} catch (std::exception &ex) {
+				state.error_manager.PushError(ErrorData(ex));
+				result = TaskExecutionResult::TASK_ERROR;
+			} catch (...) { // LCOV_EXCL_START
+				state.error_manager.PushError(ErrorData("Unknown exception during WAL replay!"));
+				result = TaskExecutionResult::TASK_ERROR;
+			} // LCOV_EXCL_STOP
+		}
+		state.FinishTask();
+		return result;
+	}
+
+private:
+	ReplayInsertTaskState &state;
+	ClientContext &context;
+	ReplayTableInserts &inserts;
+};
+
+void ReplayState::AddInsert(TableCatalogEntry &table, unique_ptr<DataChunk> chunk) {
+	auto entry = pending_insert_map.find(table);
+	idx_t index;
+	if (entry == pending_insert_map.end()) {
+		index = pending_inserts.size();
+		pending_inserts.push_back(make_uniq<ReplayTableInserts>(table));
+		pending_insert_map.insert(make_pair(reference<TableCatalogEntry>(table), index));
+	} else {
+		index = entry->second;
+	}
+	pending_insert_rows += chunk->size();
+	pending_inserts[index]->chunks.push_back(std::move(chunk));
+	if (pending_insert_rows >= MAX_PENDING_INSERT_ROWS) {
+		ApplyInserts();
+	}
+}
+
+void ReplayState::ApplyInserts() {
+	if (pending_inserts.empty()) {
+		return;
+	}
+	if (pending_inserts.size() == 1) {
+		pending_inserts[0]->Apply(context);
+	} else {
+		// the inserts into different tables are independent: apply them in parallel
+		// the inserts into a single table are applied by a single task, which preserves their order
+		auto &scheduler = TaskScheduler::GetScheduler(context);
+		ReplayInsertTaskState task_state;
+		auto token = scheduler.CreateProducer();
+		for (auto &inserts : pending_inserts) {
+			scheduler.ScheduleTask(*token, make_shared_ptr<ReplayInsertTask>(task_state, context, *inserts));
+		}
+		// work on the tasks ourselves, and wait for the tasks that were picked up by other threads to finish
+		shared_ptr<Task> task;
+		while (scheduler.GetTaskFromProducer(*token, task)) {
+			task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task.reset();
+		}
+		task_state.WaitForTasks(pending_inserts.size());
+		if (task_state.error_manager.HasError()) {
+			task_state.error_manager.ThrowException();
+		}
+	}
+	pending_inserts.clear();
+	pending_insert_map.clear();
+	pending_insert_rows = 0;
+
+	if (TransactionIsComplete()) {
+		// the inserts can belong to the transactions before the current one: commit them, so that the entries that
+		// follow can address their rows. The current transaction is complete, so it is replayed entirely anyway
+		auto &transaction = context.transaction;
+		transaction.Commit();
+		// disabling auto-commit starts the next transaction, like BEGIN TRANSACTION does
+		transaction.SetAutoCommit(false);
+		MetaTransaction::Get(context).ModifyDatabase(db);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Replay Entries
 //===--------------------------------------------------------------------===//
+//! Whether an entry can observe the contents of the tables, and therefore depends on the inserts before it. These
+//! are the catalog entries (e.g. an index is built from the data of its table), and deletes and updates, which address
+//! the rows through their row ids.
+static bool ReplayEntryDependsOnInserts(WALType entry_type) {
+	switch (entry_type) {
+	case WALType::WAL_VERSION:
+	case WALType::USE_TABLE:
+	case WALType::INSERT_TUPLE:
+	case WALType::SEQUENCE_VALUE:
+	case WALType::CHECKPOINT:
+		return false;
+	default:
+		return true;
+	}
+}
+
 void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
+	if (!DeserializeOnly() && ReplayEntryDependsOnInserts(entry_type)) {
+		// apply the inserts before this entry first
+		state.ApplyInserts();
+	}
 	switch (entry_type) {
 	case WALType::WAL_VERSION:
 		ReplayVersion();
@@ -535,7 +727,7 @@ void WriteAheadLogDeserializer::ReplayDropTableMacro() {
 void WriteAheadLogDeserializer::ReplayCreateIndex() {
 	auto create_info = deserializer.ReadProperty<unique_ptr<CreateInfo>>(101, "index_catalog_entry");
 	auto index_info = deserializer.ReadProperty<IndexStorageInfo>(102, "index_storage_info");
-	D_ASSERT(index_info.IsValid() && !index_info.name.empty());
+	D_ASSERT(!index_info.name.empty());
 
 	auto &storage_manager = db.GetStorageManager();
 	auto &single_file_sm = storage_manager.Cast<SingleFileStorageManager>();
@@ -639,8 +831,8 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
-	DataChunk chunk;
-	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+	auto chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk->Deserialize(object); });
 	if (DeserializeOnly()) {
 		return;
 	}
@@ -648,10 +840,8 @@ void WriteAheadLogDeserializer::ReplayInsert() {
 		throw InternalException("Corrupt WAL: insert without table");
 	}
 
-	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+	// append to the current table once all inserts up to the next barrier have been read
+	state.AddInsert(*state.current_table, std::move(chunk));
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
@@ -16,6 +16,9 @@
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
 
+#include <chrono>
+#include <thread>
+
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
@@ -72,6 +75,11 @@ void WriteAheadLog::Delete() {
 	if (!writer) {
 		return;
 	}
+	{
+		// the WAL is only deleted after a checkpoint: everything written to it is persistent now
+		lock_guard<mutex> guard(sync_lock);
+		synced_flush_id = written_flush_id;
+	}
 	writer.reset();
 	auto &fs = FileSystem::Get(database);
 	fs.RemoveFile(wal_path);
@@ -393,17 +401,59 @@ void WriteAheadLog::WriteAlter(const AlterInfo &info) {
 // FLUSH
 //===--------------------------------------------------------------------===//
 void WriteAheadLog::Flush() {
+	SyncFlush(WriteFlush());
+}
+
+idx_t WriteAheadLog::WriteFlush() {
 	if (!writer) {
-		return;
+		return 0;
 	}
 
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
 
-	// flushes all changes made to the WAL to disk
-	writer->Sync();
+	// hand all changes made to the WAL to the file system
+	writer->Flush();
 	wal_size = writer->GetFileSize();
+
+	lock_guard<mutex> guard(sync_lock);
+	return ++written_flush_id;
+}
+
+void WriteAheadLog::SyncFlush(idx_t flush_id) {
+	unique_lock<mutex> guard(sync_lock);
+	while (synced_flush_id < flush_id) {
+		if (sync_in_progress) {
+			// another committer is syncing the WAL - wait for it to finish and check if it covered our entries
+			sync_cv.wait(guard);
+			continue;
+		}
+		// we become the leader: sync the WAL on behalf of everyone that has written their entries
+		sync_in_progress = true;
+		guard.unlock();
+		auto commit_delay = DBConfig::Get(database).options.wal_commit_delay;
+		if (commit_delay > 0) {
+			// give concurrent committers the chance to write their entries so they can share this sync
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		guard.lock();
+		auto sync_target = written_flush_id;
+		guard.unlock();
+		try {
+			// only the file handle is synced: the buffered writer might be written to by the next committer
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		synced_flush_id = MaxValue(synced_flush_id, sync_target);
+		sync_in_progress = false;
+		sync_cv.notify_all();
+	}
 }
 
 } // namespace duckdb
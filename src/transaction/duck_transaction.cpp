@@ -188,6 +188,7 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 		storage->Commit();
 		commit_state = storage_manager.GenStorageCommitState(*log);
 		undo_buffer.WriteToWAL(*log);
+		commit_state->FlushCommit();
 	} catch (std::exception &ex) {
 		if (commit_state) {
 			commit_state->RevertCommit();
@@ -198,12 +199,22 @@ ErrorData DuckTransaction::WriteToWAL(AttachedDatabase &db, unique_ptr<StorageCo
 	return ErrorData();
 }
 
-ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id,
-                                  unique_ptr<StorageCommitState> commit_state) noexcept {
-	// "checkpoint" parameter indicates if the caller will checkpoint. If checkpoint ==
-	//    true: Then this function will NOT write to the WAL or flush/persist.
-	//          This method only makes commit in memory, expecting caller to checkpoint/flush.
-	//    false: Then this function WILL write to the WAL and Flush/Persist it.
+bool DuckTransaction::HasLocalChanges() {
+	return storage->ChangesMade();
+}
+
+ErrorData DuckTransaction::FlushLocalStorage() noexcept {
+	try {
+		storage->Commit();
+	} catch (std::exception &ex) {
+		return ErrorData(ex);
+	}
+	return ErrorData();
+}
+
+ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit_id) noexcept {
+	// the changes of this transaction have been written to the WAL already (if required)
+	// this method only makes the commit visible in memory
 	this->commit_id = new_commit_id;
 	if (!ChangesMade()) {
 		// no need to flush anything if we made no changes
@@ -215,17 +226,9 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	try {
 		storage->Commit();
 		undo_buffer.Commit(iterator_state, commit_id);
-		if (commit_state) {
-			// if we have written to the WAL - flush after the commit has been successful
-			commit_state->FlushCommit();
-		}
 		return ErrorData();
 	} catch (std::exception &ex) {
 		undo_buffer.RevertCommit(iterator_state, this->transaction_id);
-		if (commit_state) {
-			// if we have written to the WAL - truncate the WAL on failure
-			commit_state->RevertCommit();
-		}
 		return ErrorData(ex);
 	}
 }
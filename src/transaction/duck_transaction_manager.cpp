@@ -13,6 +13,7 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
@@ -223,6 +224,7 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	ErrorData error;
 	unique_ptr<lock_guard<mutex>> held_wal_lock;
 	unique_ptr<StorageCommitState> commit_state;
+	bool written_to_wal = false;
 	if (!checkpoint_decision.can_checkpoint && transaction.ShouldWriteToWAL(db)) {
 		// if we are committing changes and we are not checkpointing, we need to write to the WAL
 		// since WAL writes can take a long time - we grab the WAL lock here and unlock the transaction lock
@@ -240,21 +242,55 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		// grab the WAL lock and hold it until the entire commit is finished
 		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
 		error = transaction.WriteToWAL(db, commit_state);
+		if (!error.HasError()) {
+			// the entries of this transaction are committed in the WAL - release the WAL lock and wait for them to be
+			// synced. Other transactions can write their entries in the meantime, so that a single sync covers all of
+			// them. The commit is only made visible to other transactions after the sync, so they never observe data
+			// that is not durable. The transaction holds the checkpoint lock, so the WAL cannot be removed meanwhile
+			written_to_wal = true;
+			held_wal_lock.reset();
+			try {
+				commit_state->SyncCommit();
+			} catch (std::exception &ex) {
+				error = ErrorData(ex);
+			}
+			commit_state.reset();
+		}
 
 		// after we finish writing to the WAL we grab the transaction lock again
 		tlock.lock();
+	} else if (!checkpoint_decision.can_checkpoint && transaction.HasLocalChanges()) {
+		// we are not writing to the WAL (e.g. because this is an in-memory database), but we still have to move the
+		// appended data to the base tables - this can also take a long time, so we do this outside of the
+		// transaction lock as well, so other transactions can start and commit read-only in the meantime
+		// note that this does not make appends concurrent: committers that append are still serialized by the WAL
+		// lock (and by the append lock of every table they append to), and row ids are assigned when the data is
+		// moved to the base tables. A failed commit reverts its appends by truncating the tables, which is only
+		// correct because no other transaction can have appended to the same table after it
+		tlock.unlock();
+		held_wal_lock = make_uniq<lock_guard<mutex>>(wal_lock);
+		error = transaction.FlushLocalStorage();
+		tlock.lock();
 	}
 	// obtain a commit id for the transaction
 	transaction_t commit_id = GetCommitTimestamp();
 	// commit the UndoBuffer of the transaction
 	if (!error.HasError()) {
-		error = transaction.Commit(db, commit_id, std::move(commit_state));
+		error = transaction.Commit(db, commit_id);
 	}
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint_decision = CheckpointDecision(error.Message());
 		transaction.commit_id = 0;
-		transaction.Rollback();
+		if (written_to_wal) {
+			// the transaction is committed in the WAL, and other transactions might have written their entries and
+			// appended to the same tables after it - we can neither remove it from the WAL nor revert its appends
+			// its changes stay invisible, and we invalidate the database: it has to be restarted from the WAL
+			auto message = "Failed to commit a transaction that was written to the WAL: " + error.RawMessage();
+			ValidChecker::Invalidate(db.GetDatabase(), std::move(message));
+		} else {
+			transaction.Rollback();
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -0,0 +1,86 @@
+#include "catch.hpp"
+#include "test_helpers.hpp"
+
+#include "duckdb/optimizer/join_order/join_order_cache.hpp"
+
+using namespace duckdb;
+using namespace std;
+
+static const char *CYCLIC_JOIN_QUERY = "SELECT COUNT(*) FROM t1, t2, t3, t4, t5, t6 WHERE t1.i = t2.i AND t2.i = t3.i "
+                                       "AND t3.i = t4.i AND t4.i = t5.i AND t5.i = t6.i AND t1.i = t6.i";
+
+//! A cyclic join of six aggregates over the tables t1 to t6
+static string AggregateJoinQuery(const string &aggregate) {
+	string query = "SELECT COUNT(*) FROM ";
+	for (idx_t i = 1; i <= 6; i++) {
+		auto table = "t" + to_string(i);
+		query += i > 1 ? ", " : "";
+		query += "(SELECT " + aggregate + " AS i FROM " + table + " GROUP BY i) a" + to_string(i);
+	}
+	return query + " WHERE a1.i = a2.i AND a2.i = a3.i AND a3.i = a4.i AND a4.i = a5.i AND a5.i = a6.i AND a1.i = a6.i";
+}
+
+TEST_CASE("Test the join order cache", "[api]") {
+	DuckDB db;
+	Connection con(db);
+	auto &cache = JoinOrderCache::Get(*con.context);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE SCHEMA s1"));
+	for (idx_t i = 1; i <= 6; i++) {
+		auto table = "t" + to_string(i);
+		auto count = to_string(i * 10);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE " + table + " AS SELECT range i FROM range(" + count + ")"));
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE s1." + table + " AS SELECT range i FROM range(" + count + ")"));
+	}
+
+	// join orders that are found exactly are not cached
+	auto result = con.Query(CYCLIC_JOIN_QUERY);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == 0);
+	REQUIRE(cache.EntryCount(JoinOrderSolver::GREEDY) == 0);
+
+	// exceeding the enumeration budget makes the optimizer fall back to the linearized dynamic programming
+	REQUIRE_NO_FAIL(con.Query("SET join_order_enumeration_budget = 1"));
+	result = con.Query(CYCLIC_JOIN_QUERY);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == 1);
+	REQUIRE(cache.HitCount() == 0);
+
+	// the second time around the join order is taken from the cache
+	result = con.Query(CYCLIC_JOIN_QUERY);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == 1);
+	REQUIRE(cache.HitCount() == 1);
+
+	// same-named tables in a different schema do not share the cached join order
+	REQUIRE_NO_FAIL(con.Query("SET search_path = 's1'"));
+	result = con.Query(CYCLIC_JOIN_QUERY);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == 2);
+	REQUIRE(cache.HitCount() == 1);
+	REQUIRE_NO_FAIL(con.Query("RESET search_path"));
+
+	// relations that are not base tables are identified by the structure of their plan
+	auto entry_count = cache.EntryCount(JoinOrderSolver::LINEARIZED);
+	result = con.Query(AggregateJoinQuery("i"));
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == entry_count + 1);
+	result = con.Query(AggregateJoinQuery("MAX(i)"));
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::LINEARIZED) == entry_count + 2);
+	REQUIRE(cache.HitCount() == 1);
+	result = con.Query(AggregateJoinQuery("i"));
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.HitCount() == 2);
+
+	// disconnected join graphs cannot be linearized: the greedy algorithm is used
+	result = con.Query("SELECT COUNT(*) FROM t1, t2, t3, t4 WHERE t1.i = t2.i AND t3.i = t4.i");
+	REQUIRE(CHECK_COLUMN(result, 0, {300}));
+	REQUIRE(cache.EntryCount(JoinOrderSolver::GREEDY) == 1);
+
+	// with the cache disabled nothing is looked up or stored
+	REQUIRE_NO_FAIL(con.Query("SET enable_join_order_cache = false"));
+	result = con.Query(CYCLIC_JOIN_QUERY);
+	REQUIRE(CHECK_COLUMN(result, 0, {10}));
+	REQUIRE(cache.HitCount() == 2);
+}
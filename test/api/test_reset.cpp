@@ -53,6 +53,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"default_null_order", {"nulls_first"}},
 	    {"disabled_optimizers", {"extension"}},
 	    {"debug_force_external", {Value(true)}},
+	    {"enable_join_order_cache", {Value(false)}},
 	    {"old_implicit_casting", {Value(true)}},
 	    {"prefer_range_joins", {Value(true)}},
 	    {"allow_persistent_secrets", {Value(false)}},
@@ -71,6 +72,7 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"autoinstall_known_extensions", {true}},
 #endif
 	    {"enable_profiling", {"json"}},
+	    {"enable_scan_prefetch", {false}},
 	    {"explain_output", {{"all", "optimized_only", "physical_only"}}},
 	    {"file_search_path", {"test"}},
 	    {"force_compression", {"uncompressed", "Uncompressed"}},
@@ -97,6 +99,9 @@ OptionValueSet GetValueForOption(const string &name, LogicalTypeId type) {
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {{"none", "lz4", "adaptive"}}},
+	    {"buffer_eviction_policy", {"2q"}},
+	    {"connection_operator_memory_limit", {"4.0 GiB"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"force_bitpacking_mode", {"constant"}},
 	    {"http_logging_output", {"my_cool_outputfile"}},
@@ -3,6 +3,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 #include "duckdb/storage/storage_info.hpp"
+#include "duckdb/storage/temporary_memory_manager.hpp"
 #include "test_helpers.hpp"
 
 using namespace duckdb;
@@ -330,3 +331,36 @@ TEST_CASE("Test buffer allocator", "[storage][.]") {
 
 	allocator.FreeData(pointer, current_size);
 }
+
+TEST_CASE("Test the memory limit of a connection in the temporary memory manager", "[storage]") {
+	DuckDB db(nullptr);
+	Connection limited(db);
+	Connection unlimited(db);
+	REQUIRE_NO_FAIL(limited.Query("PRAGMA memory_limit='1GB'"));
+	REQUIRE_NO_FAIL(limited.Query("PRAGMA threads=1"));
+	REQUIRE_NO_FAIL(limited.Query("SET connection_operator_memory_limit='32MB'"));
+	const idx_t connection_limit = 32000000;
+	const idx_t remaining_size = 100000000;
+
+	auto &temporary_memory_manager = TemporaryMemoryManager::Get(*limited.context);
+	for (auto &temp_directory : {TestCreatePath("connection_operator_memory_limit"), string()}) {
+		// the limit is enforced with and without a temporary directory
+		REQUIRE_NO_FAIL(limited.Query("SET temp_directory='" + temp_directory + "'"));
+
+		auto limited_state = temporary_memory_manager.Register(*limited.context);
+		auto unlimited_state = temporary_memory_manager.Register(*unlimited.context);
+		limited_state->SetRemainingSize(*limited.context, remaining_size);
+		unlimited_state->SetRemainingSize(*unlimited.context, remaining_size);
+		// updating the state of the limited connection again must not apply its limit to the other connection
+		limited_state->SetRemainingSize(*limited.context, remaining_size);
+
+		REQUIRE(limited_state->GetReservation() <= connection_limit);
+		REQUIRE(unlimited_state->GetReservation() == remaining_size);
+
+		// the states of a connection share its limit: another state only gets its minimum reservation
+		auto second_state = temporary_memory_manager.Register(*limited.context);
+		second_state->SetRemainingSize(*limited.context, remaining_size);
+		REQUIRE(second_state->GetReservation() <=
+		        MaxValue<idx_t>(connection_limit - limited_state->GetReservation(), connection_limit / 16));
+	}
+}
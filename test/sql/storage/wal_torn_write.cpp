@@ -2,6 +2,13 @@
 #include "duckdb/common/file_system.hpp"
 #include "test_helpers.hpp"
 #include "duckdb/common/local_file_system.hpp"
+#include "duckdb/common/virtual_file_system.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+#include <chrono>
+#include <thread>
 
 using namespace duckdb;
 using namespace std;
@@ -116,3 +123,109 @@ TEST_CASE("Test WAL checksums", "[storage][.]") {
 	}
 	DeleteDatabase(storage_database);
 }
+
+//! Handles the WAL files of the virtual file system, and can block or fail their syncs
+class WALSyncFileSystem : public LocalFileSystem {
+public:
+	bool CanHandleFile(const string &fpath) override {
+		return StringUtil::EndsWith(fpath, ".wal");
+	}
+	std::string GetName() const override {
+		return "WALSyncFileSystem";
+	}
+	void FileSync(FileHandle &handle) override {
+		sync_started = true;
+		while (block_sync) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		if (fail_sync) {
+			throw IOException("Injected failure to sync the WAL");
+		}
+		LocalFileSystem::FileSync(handle);
+	}
+
+	atomic<bool> sync_started {false};
+	atomic<bool> block_sync {false};
+	atomic<bool> fail_sync {false};
+};
+
+TEST_CASE("Test that commits are only visible after the WAL is synced", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("wal_sync_visibility");
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	auto file_system = make_uniq<VirtualFileSystem>();
+	auto wal_file_system = make_uniq<WALSyncFileSystem>();
+	auto &sync_file_system = *wal_file_system;
+	file_system->RegisterSubSystem(std::move(wal_file_system));
+	config->file_system = std::move(file_system);
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		Connection other(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers (i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+
+		// block the sync of the next commit
+		sync_file_system.sync_started = false;
+		sync_file_system.block_sync = true;
+		atomic<bool> committed {false};
+		std::thread committer([&]() { committed = !con.Query("INSERT INTO integers VALUES (2)")->HasError(); });
+		while (!sync_file_system.sync_started) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		}
+		// the commit is not visible while it is not durable
+		auto result = other.Query("SELECT SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+		sync_file_system.block_sync = false;
+		committer.join();
+		REQUIRE(committed);
+
+		result = other.Query("SELECT SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {3}));
+	}
+	DeleteDatabase(storage_database);
+}
+
+TEST_CASE("Test a failing sync of the WAL during commit", "[storage]") {
+	auto config = GetTestConfig();
+	auto storage_database = TestCreatePath("wal_sync_failure");
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	auto file_system = make_uniq<VirtualFileSystem>();
+	auto wal_file_system = make_uniq<WALSyncFileSystem>();
+	auto &sync_file_system = *wal_file_system;
+	file_system->RegisterSubSystem(std::move(wal_file_system));
+	config->file_system = std::move(file_system);
+
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers (i INTEGER)"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO integers VALUES (1)"));
+		con.BeginTransaction();
+		auto attached = db.instance->GetDatabaseManager().GetDatabase(*con.context, "wal_sync_failure");
+		con.Commit();
+		REQUIRE(attached);
+
+		sync_file_system.fail_sync = true;
+		REQUIRE_FAIL(con.Query("INSERT INTO integers VALUES (2)"));
+		sync_file_system.fail_sync = false;
+
+		// the failed transaction is no longer active
+		REQUIRE(DuckTransactionManager::Get(*attached).LowestActiveStart() == TRANSACTION_ID_START);
+		// the database is invalidated: the WAL might contain a commit that the client was told had failed
+		REQUIRE_FAIL(con.Query("SELECT SUM(i) FROM integers"));
+	}
+	{
+		// after a restart, the committed data is there
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*) FROM integers WHERE i = 1");
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	}
+	DeleteDatabase(storage_database);
+}